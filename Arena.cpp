@@ -0,0 +1,43 @@
+#include "Arena.hpp"
+#include <cstring>
+
+char* Arena::allocate(size_t size, size_t alignment) {
+    // blocks come from new[], aligned for any fundamental type
+    size_t at = (_used + alignment - 1) & ~(alignment - 1);
+    if (at + size > _capacity) {
+        // oversized requests get a block of their own
+        _capacity = size > BlockSize ? size : BlockSize;
+        _blocks.emplace_back(new char[_capacity]);
+        _bytes += _capacity;
+        at = 0;
+    };
+    char* result = _blocks.back().get() + at;
+    _used = at + size;
+    return result;
+};
+
+const char* Arena::store(std::string_view s) {
+    char* result = allocate(s.length() + 1);
+    memcpy(result, s.data(), s.length());
+    result[s.length()] = '\0';
+    return result;
+};
+
+void Arena::clear() {
+    for (auto i = _finalizers.rbegin(); i != _finalizers.rend(); ++i)
+        i->second(i->first);
+    _finalizers.clear();
+    _blocks.clear();
+    _used = _capacity = BlockSize;
+    _bytes = 0;
+};
+
+void Arena::adopt(Arena& other) {
+    // keep allocating from our own last block
+    _blocks.insert(_blocks.end() - (_blocks.empty() ? 0 : 1),
+                   std::make_move_iterator(other._blocks.begin()), std::make_move_iterator(other._blocks.end()));
+    _finalizers.insert(_finalizers.end(), other._finalizers.begin(), other._finalizers.end());
+    other._finalizers.clear();
+    _bytes += other._bytes;
+    other.clear();
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bump allocator for token payloads (decoded string literals) and AST nodes. Blocks are
+// never moved or freed one by one, so the returned pointers stay valid until clear()
+// or destruction releases everything in bulk.
+class Arena {
+    public:
+        Arena() : _used(BlockSize), _capacity(BlockSize), _bytes(0) {};
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        ~Arena() { clear(); };
+
+        // Copies s and appends a terminating '\0'
+        const char* store(std::string_view s);
+        // Constructs a T in place. Destructors with work to do run on clear() or
+        // destruction, latest object first; trivial ones are never called.
+        template<typename T, typename... Args>
+        T* make(Args&&... args);
+        // Uninitialized room for n objects of a trivially destructible T
+        template<typename T>
+        T* array(size_t n);
+        void clear();
+        // Takes over other's blocks, pointers into them stay valid
+        void adopt(Arena& other);
+        size_t blocks() const { return _blocks.size(); };
+        size_t bytes() const { return _bytes; };
+
+    private:
+        typedef std::pair<void*, void (*)(void*)> Finalizer_t;
+
+        char* allocate(size_t size, size_t alignment = 1);
+
+        static const size_t BlockSize = 64 * 1024;
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        std::vector<Finalizer_t> _finalizers;
+        size_t _used;
+        size_t _capacity;
+        // sum of the block sizes
+        size_t _bytes;
+};
+
+template<typename T, typename... Args>
+T* Arena::make(Args&&... args) {
+    T* result = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        _finalizers.push_back({ result, [](void* p) { static_cast<T*>(p)->~T(); } });
+    return result;
+};
+
+template<typename T>
+T* Arena::array(size_t n) {
+    static_assert(std::is_trivially_destructible_v<T>, "Arena::array never runs destructors");
+    return reinterpret_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+};
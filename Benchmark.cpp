@@ -0,0 +1,381 @@
+#include "Benchmark.hpp"
+#include "ParallelLexer.hpp"
+#include "IncrementalLexer.hpp"
+#include "ProgramGenerator.hpp"
+#include <filesystem>
+#include <algorithm>
+#include <random>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+const size_t Benchmark::SyntheticSizes[3] = { 1, 10, 100 };
+
+Benchmark::Files_t Benchmark::listSources(const std::string& corpus) {
+    Files_t files;
+    if (std::filesystem::is_regular_file(corpus))
+        files.push_back(corpus);
+    else if (std::filesystem::is_directory(corpus))
+        for (auto& i : std::filesystem::recursive_directory_iterator(corpus))
+            if (i.is_regular_file() && (i.path().extension() == ".txt" || i.path().extension() == ".pas") &&
+                i.path().filename() != "res.txt")
+                files.push_back(i.path().string());
+    std::sort(files.begin(), files.end());
+    return files;
+};
+
+std::vector<std::string> Benchmark::collectWords(const Files_t& files) {
+    std::vector<std::string> words;
+    for (auto& i : files) {
+        LexicalAnalyzer lexer(i.c_str());
+        try {
+            while (!lexer.eof()) {
+                Token t = lexer.nextToken();
+                if (t._class == Token::Class::Identifier || t._class == Token::Class::ReservedWord ||
+                    t._class == Token::Class::Operator || t._class == Token::Class::Separator)
+                    words.push_back(t.toString());
+            };
+        }
+        catch (const std::exception&) {
+            // error fixtures still contribute the tokens before the error
+        };
+    };
+    return words;
+};
+
+double Benchmark::nanosecondsSince(Clock_t::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock_t::now() - start).count();
+};
+
+void Benchmark::keywords(const std::string& corpus, std::ostream& os) {
+    const int repetitions = 200;
+    std::vector<std::string> words = collectWords(listSources(corpus));
+    if (words.empty()) {
+        os << "No tokens found in \"" << corpus << "\"\n";
+        return;
+    };
+
+    std::map<std::string, std::pair<Token::SubClass, Token::Class>> dict;
+    for (auto i : Token::_keywordSlots)
+        if (i != Token::NoKeyword)
+            dict.insert({ Token::_keywords[i].text, { Token::_keywords[i].subClass, Token::_keywords[i].cls } });
+
+    size_t checksum = 0;
+    auto start = Clock_t::now();
+    for (int r = 0; r < repetitions; ++r)
+        for (auto& w : words) {
+            Token::Class c = dict.count(w) ? dict.at(w).second : Token::Class::Identifier;
+            Token::SubClass s = dict.count(w) ? dict.at(w).first : Token::SubClass::Identifier;
+            checksum += static_cast<size_t>(c) + static_cast<size_t>(s);
+        };
+    double mapTime = nanosecondsSince(start);
+
+    size_t hashChecksum = 0;
+    start = Clock_t::now();
+    for (int r = 0; r < repetitions; ++r)
+        for (auto& w : words) {
+            const Token::Keyword_t* k = Token::findKeyword(w);
+            Token::Class c = k ? k->cls : Token::Class::Identifier;
+            Token::SubClass s = k ? k->subClass : Token::SubClass::Identifier;
+            hashChecksum += static_cast<size_t>(c) + static_cast<size_t>(s);
+        };
+    double hashTime = nanosecondsSince(start);
+
+    double lookups = static_cast<double>(words.size()) * repetitions;
+    os << "words:        " << words.size() << " x " << repetitions << "\n"
+       << "std::map:     " << mapTime / lookups << " ns/token\n"
+       << "perfect hash: " << hashTime / lookups << " ns/token\n"
+       << "speedup:      " << mapTime / hashTime << "x\n";
+    if (checksum != hashChecksum)
+        os << "MISMATCH: lookups disagree\n";
+};
+
+// Lexes every file to the end (or to its first error) and returns a checksum of the
+// token stream, so both runs can be checked to agree
+size_t Benchmark::lexAll(const Files_t& files, bool skipRuns, size_t& bytes) {
+    size_t checksum = 0;
+    for (auto& i : files) {
+        LexicalAnalyzer lexer(i.c_str());
+        lexer._skipRuns = skipRuns;
+        bytes += lexer._source.size();
+        try {
+            while (!lexer.eof()) {
+                Token t = lexer.nextToken();
+                checksum = checksum * 31 + static_cast<size_t>(t._subClass) + t._offset;
+            };
+        }
+        catch (const std::exception&) {
+        };
+    };
+    return checksum;
+};
+
+void Benchmark::lexer(const std::string& corpus, std::ostream& os) {
+    const int repetitions = 50;
+    Files_t files = listSources(corpus);
+    if (files.empty()) {
+        os << "No sources found in \"" << corpus << "\"\n";
+        return;
+    };
+
+    // DFA only with each engine, run skipping, run skipping on every hardware thread
+    unsigned threads = std::max(2u, std::thread::hardware_concurrency());
+    LexicalAnalyzer::Engine engine = LexicalAnalyzer::engine();
+    double time[4];
+    size_t checksum[4], bytes[4] = { 0, 0, 0, 0 };
+    for (int mode = 0; mode < 4; ++mode) {
+        LexicalAnalyzer::setThreads(mode == 3 ? threads : 1);
+        LexicalAnalyzer::setEngine(mode == 1 ? LexicalAnalyzer::Engine::Direct : LexicalAnalyzer::Engine::Table);
+        auto start = Clock_t::now();
+        for (int r = 0; r < repetitions; ++r)
+            checksum[mode] = lexAll(files, mode > 1, bytes[mode]);
+        time[mode] = nanosecondsSince(start);
+    };
+    LexicalAnalyzer::setThreads(1);
+    LexicalAnalyzer::setEngine(engine);
+
+    os << "files:        " << files.size() << ", " << bytes[0] / repetitions << " bytes x " << repetitions << "\n"
+       << "DFA only:     " << bytes[0] / time[0] * 1e3 << " MB/s\n"
+       << "direct-coded: " << bytes[1] / time[1] * 1e3 << " MB/s (" << time[0] / time[1] << "x)\n"
+       << "run skipping: " << bytes[2] / time[2] * 1e3 << " MB/s (" << SimdScanner::instructionSet() << ")\n"
+       << "speedup:      " << time[0] / time[2] << "x\n"
+       << "parallel:     " << bytes[3] / time[3] * 1e3 << " MB/s (" << threads << " threads, files over "
+       << 2 * ParallelLexer::MinChunkSize / 1024 << " KB)\n";
+    if (checksum[0] != checksum[1] || checksum[0] != checksum[2] || checksum[0] != checksum[3])
+        os << "MISMATCH: token streams differ\n";
+};
+
+std::string Benchmark::lexText(const std::string& text, std::vector<Token>& tokens, Arena& arena) {
+    const char* base = text.data();
+    LexicalAnalyzer lexer(base, base, base + text.size(), base + text.size(), FiniteAutomata::States::Whitespace);
+    lexer._window = false;
+    std::string error;
+    try {
+        do
+            tokens.push_back(lexer.nextToken());
+        while (tokens.back()._subClass != Token::SubClass::EndOfFile);
+    }
+    catch (const std::exception& e) {
+        error = e.what();
+    };
+    arena.adopt(lexer._arena);
+    return error;
+};
+
+// The edits are picked with the engine alone, like ProgramGenerator does, so every library
+// replays the same sequence. Snippets open and close comments, strings and lines, which
+// makes the re-lexing run past the edit.
+void Benchmark::incremental(const std::string& corpus, std::ostream& os) {
+    const int edits = 200;
+    static const char* const snippets[] = { "", " ", "a", "1", ".", "'", "{", "}", "(*", "*)", "//", "\n", "\r\n", ":=", "x1 ", "begin " };
+    Files_t files = listSources(corpus);
+    if (files.empty()) {
+        os << "No sources found in \"" << corpus << "\"\n";
+        return;
+    };
+
+    std::mt19937 rng(1);
+    size_t tokens = 0, relexed = 0, mismatches = 0;
+    double incrementalTime = 0, freshTime = 0;
+    for (auto& i : files) {
+        SourceBuffer source(i);
+        IncrementalLexer lexer(std::string(source.begin(), source.size()));
+        for (int e = 0; e < edits; ++e) {
+            IncrementalLexer::Edit_t edit = { rng() % (lexer.text().size() + 1), rng() % 4, snippets[rng() % (sizeof(snippets) / sizeof(*snippets))] };
+            auto start = Clock_t::now();
+            relexed += lexer.apply(edit);
+            incrementalTime += nanosecondsSince(start);
+
+            std::vector<Token> fresh;
+            Arena strings;
+            start = Clock_t::now();
+            std::string error = lexText(lexer.text(), fresh, strings);
+            freshTime += nanosecondsSince(start);
+            tokens += fresh.size();
+
+            LineIndex lines;
+            lines.build(lexer.text().data(), lexer.text().data() + lexer.text().size());
+            bool same = fresh.size() == lexer.size() && error == lexer.error();
+            for (size_t k = 0; same && k < fresh.size(); ++k)
+                same = fresh[k]._subClass == lexer.subClass(k) && fresh[k]._offset == lexer.offset(k) &&
+                       fresh[k].toString() == lexer.text(k) && lexer.raw(k) == (fresh[k]._subClass == Token::SubClass::EndOfFile ?
+                       std::string_view(LexicalAnalyzer::_eofText) : std::string_view(lexer.text()).substr(fresh[k]._offset, fresh[k]._length)) &&
+                       lines.position(fresh[k]._offset) == lexer.position(k);
+            mismatches += !same;
+        };
+    };
+
+    double applied = static_cast<double>(files.size()) * edits;
+    os << "files:        " << files.size() << ", " << edits << " edits each\n"
+       << "tokens:       " << tokens / applied << " per edit, " << relexed / applied << " lexed again\n"
+       << "incremental:  " << incrementalTime / applied / 1e3 << " us/edit\n"
+       << "from scratch: " << freshTime / applied / 1e3 << " us/edit (" << freshTime / incrementalTime << "x)\n";
+    if (mismatches)
+        os << "MISMATCH: " << mismatches << " edits leave a token stream that differs from lexing from scratch\n";
+};
+
+// High-water mark of the whole process, so it only ever grows from one phase to the next
+size_t Benchmark::peakRss() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+};
+
+size_t Benchmark::countNodes(const Node::PNode_t& node) {
+    size_t count = 1;
+    for (auto& i : node->_children)
+        count += countNodes(i);
+    return count;
+};
+
+// One untimed warm-up pass, then the median of the timed ones. Nodes are counted the same
+// way the -ast log walks the tree, and the tree is flattened, outside of the timed passes.
+Benchmark::Phase_t Benchmark::measure(const Files_t& files, size_t repetitions, Pass pass) {
+    Phase_t phase = {};
+    std::vector<double> times;
+    for (size_t r = 0; r <= repetitions; ++r) {
+        size_t tokens = 0, errors = 0;
+        auto start = Clock_t::now();
+        for (auto& i : files)
+            if (pass != Pass::Lexer) {
+                Parser parser(i.c_str());
+                try {
+                    // bodies are skimmed first to be parsed on Parser's threads
+                    parser.buildTree(pass == Pass::Outline || Parser::_threads > 1);
+                    if (pass == Pass::Parser)
+                        parser.parseBodies();
+                }
+                catch (const std::exception&) {
+                    ++errors;
+                };
+                tokens += parser._lexicalAnalyzer->_consumed;
+                if (!r && parser._root && pass == Pass::Parser) {
+                    phase.nodes += countNodes(parser._root);
+                    phase.treeBytes += parser._nodes.bytes();
+                    phase.flatBytes += parser.flatten().bytes();
+                };
+            }
+            else {
+                LexicalAnalyzer lexer(i.c_str());
+                try {
+                    for (; !lexer.eof(); ++tokens)
+                        lexer.nextToken();
+                }
+                catch (const std::exception&) {
+                    ++errors;
+                };
+            };
+        if (r)
+            times.push_back(nanosecondsSince(start));
+        phase.tokens = tokens;
+        phase.errors = errors;
+    };
+    std::sort(times.begin(), times.end());
+    phase.seconds = times[times.size() / 2] / 1e9;
+    phase.peakRss = peakRss();
+    return phase;
+};
+
+void Benchmark::writePhase(const char* name, const Phase_t& phase, size_t bytes, bool nodes, std::ostream& os) {
+    os << "      \"" << name << "\": {\n"
+       << "        \"seconds\": " << phase.seconds << ",\n"
+       << "        \"tokens\": " << phase.tokens << ",\n"
+       << "        \"tokensPerSecond\": " << static_cast<uint64_t>(phase.tokens / phase.seconds) << ",\n"
+       << "        \"bytesPerSecond\": " << static_cast<uint64_t>(bytes / phase.seconds) << ",\n";
+    if (nodes)
+        os << "        \"nodes\": " << phase.nodes << ",\n"
+           << "        \"nodesPerSecond\": " << static_cast<uint64_t>(phase.nodes / phase.seconds) << ",\n"
+           << "        \"treeBytes\": " << phase.treeBytes << ",\n"
+           << "        \"flatBytes\": " << phase.flatBytes << ",\n";
+    os << "        \"errors\": " << phase.errors << ",\n"
+       << "        \"peakRssBytes\": " << phase.peakRss << "\n"
+       << "      }";
+};
+
+// Inputs run from the smallest to the largest and the lexer before the parser, so that
+// the growth of the process-wide peak RSS can be read per phase
+void Benchmark::suite(const std::string& corpus, std::ostream& os) {
+    // every phase runs its input at least this many times and for at least workload bytes
+    const size_t minRepetitions = 3;
+    const size_t workload = 64 << 20;
+
+    struct Input_t {
+        std::string name;
+        Files_t files;
+        bool synthetic;
+    };
+    std::vector<Input_t> inputs;
+    Files_t files = listSources(corpus);
+    if (!files.empty())
+        inputs.push_back({ corpus, files, false });
+    // the balanced mix at every size, then each other mix on its own at MixSize
+    std::vector<std::pair<ProgramGenerator::Mix, size_t>> programs;
+    for (auto i : SyntheticSizes)
+        programs.push_back({ ProgramGenerator::Mix::Balanced, i });
+    for (auto i : { ProgramGenerator::Mix::Lexer, ProgramGenerator::Mix::Symbols, ProgramGenerator::Mix::Expressions, ProgramGenerator::Mix::Codegen })
+        programs.push_back({ i, MixSize });
+    std::stable_sort(programs.begin(), programs.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+    for (auto& i : programs) {
+        std::string name = std::string("synthetic-") + ProgramGenerator::mixName(i.first) + "-" + std::to_string(i.second) + "MB";
+        std::string path = (std::filesystem::temp_directory_path() / (name + ".pas")).string();
+        ProgramGenerator::Options_t options = ProgramGenerator::Defaults;
+        options.size = i.second << 20;
+        options.mix = i.first;
+        // enough globals to load the symbol table and the interner
+        if (i.first == ProgramGenerator::Mix::Symbols)
+            options.identifiers = 1024;
+        std::ofstream file(path, std::ios::binary);
+        ProgramGenerator(options).generate(file);
+        inputs.push_back({ name, Files_t({ path }), true });
+    };
+
+    std::string escaped;
+    for (auto c : corpus)
+        escaped += c == '\\' || c == '"' ? std::string({ '\\', c }) : std::string(1, c);
+
+    os << "{\n"
+       << "  \"engine\": \"" << (LexicalAnalyzer::engine() == LexicalAnalyzer::Engine::Direct ? "direct" : "table") << "\",\n"
+       << "  \"simd\": \"" << SimdScanner::instructionSet() << "\",\n"
+       << "  \"threads\": " << LexicalAnalyzer::_threads << ",\n"
+       << "  \"inputs\": [\n";
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        size_t bytes = 0;
+        for (auto& j : inputs[i].files)
+            bytes += static_cast<size_t>(std::filesystem::file_size(j));
+        size_t repetitions = std::max(minRepetitions, workload / std::max<size_t>(bytes, 1));
+        Phase_t lex = measure(inputs[i].files, repetitions, Pass::Lexer);
+        Phase_t outline = measure(inputs[i].files, repetitions, Pass::Outline);
+        Phase_t parse = measure(inputs[i].files, repetitions, Pass::Parser);
+        if (inputs[i].synthetic)
+            std::filesystem::remove(inputs[i].files.front());
+
+        os << "    {\n"
+           << "      \"name\": \"" << (inputs[i].synthetic ? inputs[i].name : escaped) << "\",\n"
+           << "      \"files\": " << inputs[i].files.size() << ",\n"
+           << "      \"bytes\": " << bytes << ",\n"
+           << "      \"repetitions\": " << repetitions << ",\n";
+        writePhase("lexer", lex, bytes, false, os);
+        os << ",\n";
+        writePhase("outline", outline, bytes, false, os);
+        os << ",\n";
+        writePhase("parser", parse, bytes, true, os);
+        os << "\n    }" << (i + 1 < inputs.size() ? "," : "") << "\n";
+    };
+    os << "  ]\n"
+       << "}\n";
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include "LexicalAnalyzer.hpp"
+#include "Parser.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+class Benchmark {
+
+    typedef std::chrono::steady_clock Clock_t;
+    typedef std::vector<std::string> Files_t;
+
+    enum class Pass {
+        Lexer,      // every token
+        Outline,    // buildTree skimming routine bodies
+        Parser,     // buildTree
+    };
+
+    // One phase over one input: the median of the timed passes, counts are per pass
+    struct Phase_t {
+        double seconds;
+        size_t tokens;
+        size_t nodes;
+        // the node arena against the same tree flattened, see FlatTree
+        size_t treeBytes;
+        size_t flatBytes;
+        size_t errors;
+        size_t peakRss;
+    };
+
+    public:
+        // Keyword/operator recognition: the old std::map dictionary against Token::findKeyword,
+        // fed with every word-like token of the sources under corpus
+        static void keywords(const std::string& corpus, std::ostream& os);
+        // Lexer throughput in bytes/second: table-driven and direct-coded DFA, SIMD run skipping,
+        // then in parallel
+        static void lexer(const std::string& corpus, std::ostream& os);
+        // IncrementalLexer against lexing from scratch: a seeded sequence of small edits to each
+        // source under corpus, the token stream checked after every edit
+        static void incremental(const std::string& corpus, std::ostream& os);
+        // Lexer, outline and parser throughput, measured separately over the sources under corpus and over
+        // generated programs: the balanced mix of SyntheticSizes megabytes and every other mix of
+        // MixSize megabytes. Written to os as JSON.
+        static void suite(const std::string& corpus, std::ostream& os);
+
+        static const size_t SyntheticSizes[3];
+        static const size_t MixSize = 10;
+
+    private:
+        static Files_t listSources(const std::string& corpus);
+        static std::vector<std::string> collectWords(const Files_t& files);
+        static double nanosecondsSince(Clock_t::time_point start);
+        static size_t lexAll(const Files_t& files, bool skipRuns, size_t& bytes);
+        // The tokens of text up to the end or the first error, whose message it returns. String
+        // literals are kept in arena.
+        static std::string lexText(const std::string& text, std::vector<Token>& tokens, Arena& arena);
+        static Phase_t measure(const Files_t& files, size_t repetitions, Pass pass);
+        static size_t countNodes(const Node::PNode_t& node);
+        static size_t peakRss();
+        static void writePhase(const char* name, const Phase_t& phase, size_t bytes, bool nodes, std::ostream& os);
+};
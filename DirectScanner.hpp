@@ -0,0 +1,174 @@
+#pragma once
+#include "FiniteAutomata.hpp"
+#include <utility>
+
+// The lexer DFA as code instead of tables, in the style of re2c output: every state has
+// code of its own, a loop over the characters that keep the automaton in it, and every
+// transition is a branch of a binary search over byte ranges whose bounds and targets are
+// constants, ending in a jump to the code of the state it leads to. The ranges are cut
+// from FiniteAutomata::states at compile time, so this and FiniteAutomata::next always
+// run the same automaton.
+//
+// Only the steps LexicalAnalyzer::scan has nothing to do on are taken here; the first one
+// it has to act on ends the run and is handed back to it.
+class DirectScanner {
+
+    typedef FiniteAutomata::States States;
+
+    // run i takes the bytes (last[i - 1], last[i]] to to[i], quietly or not
+    struct Ranges_t {
+        unsigned char last[256];
+        States to[256];
+        bool quiet[256];
+        unsigned int amount;
+    };
+
+    public:
+        // Runs the automaton from state over [cursor, limit) for as long as its steps are
+        // quiet(). Returns the state it stops in with cursor at the first character it
+        // didn't take and, unless that is limit, the state the character leads to in exit.
+        static States run(States state, const char*& cursor, const char* limit, States& exit);
+
+    private:
+        // Jumps from state to state before run() starts over from the one it got to. Bounds
+        // the depth of the calls, which unoptimized builds don't turn into jumps.
+        static const unsigned int MaxHops = 64;
+
+        // Whether scan() only moves on when a character takes from to to: the token goes on,
+        // or there is none yet. Has to agree with the switch in LexicalAnalyzer::scan.
+        static constexpr bool quiet(States from, States to);
+        // States scan() only notes the beginning of the token in, neither strings nor comments
+        static constexpr bool inToken(States state);
+        static constexpr Ranges_t ranges(States state);
+
+        template<States State>
+        struct Row {
+            static constexpr Ranges_t runs = ranges(State);
+        };
+
+        typedef States (*Code_t)(const char*&, const char*, unsigned int&, States&);
+
+        // The code of State. Returns what run() does.
+        template<States State>
+        static States at(const char*& p, const char* limit, unsigned int& hops, States& exit);
+        // The branches of State on the runs [From, To) for c at p. Returns Amount if c keeps
+        // the automaton in State, otherwise the state the run stops in.
+        template<States State, unsigned int From, unsigned int To>
+        static States branch(unsigned char c, const char*& p, const char* limit, unsigned int& hops, States& exit);
+
+        template<size_t... Rows>
+        static constexpr std::array<Code_t, sizeof...(Rows)> entries(std::index_sequence<Rows...>) {
+            return { &at<static_cast<States>(Rows)>... };
+        };
+};
+
+constexpr bool DirectScanner::inToken(States state) {
+    switch (state) {
+    case States::Percent:
+    case States::Dollar:
+    case States::Ampersand:
+    case States::Identifier:
+    case States::OperatorDot:
+    case States::OperatorCompare:
+    case States::OperatorMult:
+    case States::OperatorAssign:
+    case States::Operator:
+    case States::Decimal:
+    case States::Bin:
+    case States::Oct:
+    case States::Hex:
+    case States::Float:
+    case States::FloatingPoint:
+    case States::FloatExp:
+    case States::FloatExpSign:
+    case States::FloatEnd:
+    case States::LeftParenthesis:
+    case States::Slash:
+        return true;
+    default:
+        return false;
+    };
+};
+
+constexpr bool DirectScanner::quiet(States from, States to) {
+    switch (to) {
+    case States::Whitespace:
+        // the end of a multiline comment, scan() may have to note it
+        return from != States::MultilineComment && from != States::Asterisk;
+    case States::NewLine:
+    case States::CommentNewLine:
+    case States::Comment:
+    case States::MultilineComment:
+    case States::Asterisk:
+        return true;
+    default:
+        // scan() notes where a token begins, so only one already begun goes on here
+        return inToken(from) && inToken(to);
+    };
+};
+
+// Bytes past ASCII start UTF-8 sequences and a CR may be folded with the LF after it, so
+// scan() reads both itself
+constexpr DirectScanner::Ranges_t DirectScanner::ranges(States state) {
+    Ranges_t result = {};
+    const auto& row = FiniteAutomata::states[FiniteAutomata::row(state)];
+    for (unsigned int c = 0; c < 256; ++c) {
+        States to = row[FiniteAutomata::classes[c]];
+        bool isQuiet = c < 0x80 && c != '\r' && quiet(state, to);
+        if (!result.amount || result.to[result.amount - 1] != to || result.quiet[result.amount - 1] != isQuiet) {
+            result.to[result.amount] = to;
+            result.quiet[result.amount++] = isQuiet;
+        };
+        result.last[result.amount - 1] = static_cast<unsigned char>(c);
+    };
+    return result;
+};
+
+template<FiniteAutomata::States State>
+inline FiniteAutomata::States DirectScanner::at(const char*& p, const char* limit, unsigned int& hops, States& exit) {
+    while (p != limit) {
+        States stop = branch<State, 0, Row<State>::runs.amount>(static_cast<unsigned char>(*p), p, limit, hops, exit);
+        if (stop != States::Amount)
+            return stop;
+    };
+    return State;
+};
+
+template<FiniteAutomata::States State, unsigned int From, unsigned int To>
+inline FiniteAutomata::States DirectScanner::branch(unsigned char c, const char*& p, const char* limit, unsigned int& hops, States& exit) {
+    if constexpr (To - From == 1) {
+        constexpr States to = Row<State>::runs.to[From];
+        if constexpr (!Row<State>::runs.quiet[From]) {
+            exit = to;
+            return State;
+        }
+        else if constexpr (to == State) {
+            ++p;
+            return States::Amount;
+        }
+        else {
+            ++p;
+            return --hops ? at<to>(p, limit, hops, exit) : to;
+        };
+    }
+    else {
+        constexpr unsigned int middle = (From + To) / 2;
+        if (c <= Row<State>::runs.last[middle - 1])
+            return branch<State, From, middle>(c, p, limit, hops, exit);
+        return branch<State, middle, To>(c, p, limit, hops, exit);
+    };
+};
+
+inline FiniteAutomata::States DirectScanner::run(States state, const char*& cursor, const char* limit, States& exit) {
+    static constexpr std::array<Code_t, FiniteAutomata::RowStates> code =
+        entries(std::make_index_sequence<FiniteAutomata::RowStates>());
+    unsigned int hops;
+    do {
+        hops = MaxHops;
+        state = code[FiniteAutomata::row(state)](cursor, limit, hops, exit);
+    } while (!hops);
+    return state;
+};
+
+static_assert(FiniteAutomata::classes['\r'] == FiniteAutomata::classes['\n'],
+              "scan() reads CR LF as LF, DirectScanner hands back the step on CR for it");
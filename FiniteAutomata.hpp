@@ -1,98 +1,491 @@
-#pragma once
-namespace FiniteAutomata {
-	enum class States {
-		TokenEnd,
-		Whitespace,
-		Bin,
-		NewLine,
-		Identifier,
-		LookBack,
-		Percent,
-		Dollar,
-		Oct,
-		Ampersand,
-		Decimal,
-		FloatingPoint,
-		Float,
-		FloatExp,
-		FloatExpSign,
-		FloatEnd,
-		Hex,
-		String,
-		StringStart,
-		StringEnd,
-		ControlString,
-		DecimalCharCode,
-		BinCharCode,
-		HexCharCode,
-		OctCharCode,
-		Operator,
-		OperatorDot,
-		OperatorLess,
-		OperatorGreater,
-		OperatorMult,
-		OperatorPlus,
-		Slash,
-		Colon,
-		Separator,
-		LeftParenthesis,
-		BeginComment,
-		Comment,
-		BeginMultilineComment,
-		MultilineComment,
-		CommentNewLine,
-		Asterisk,
-		Amount,
-		EndOfFile,
-		IllegalSymbol,
-		UnexpectedSymbol,
-		EOLnWhileReading,
-		UnexpectedEndOfFile,
-		ScaleFactorExpected,
-		NumberExpected,
-	};
-
-	static const States states[static_cast<unsigned int>(States::Amount)][128] = {
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::Dollar,            States::Percent,           States::Ampersand,         States::StringStart,       States::LeftParenthesis,   States::Separator,         States::OperatorMult,           States::OperatorPlus,      States::Separator,         States::OperatorPlus,      States::OperatorDot,       States::Slash,             States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Colon,             States::Separator,         States::OperatorLess,      States::Operator,          States::OperatorGreater,   States::IllegalSymbol,     States::Operator,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::Separator,         States::IllegalSymbol,     States::Separator,         States::Operator,          States::Identifier,        States::IllegalSymbol,     States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::BeginMultilineComment,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::EndOfFile,            },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::Dollar,            States::Percent,           States::Ampersand,         States::StringStart,       States::LeftParenthesis,   States::Separator,         States::OperatorMult,           States::OperatorPlus,      States::Separator,         States::OperatorPlus,      States::OperatorDot,       States::Slash,             States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Colon,             States::Separator,         States::OperatorLess,      States::Operator,          States::OperatorGreater,   States::IllegalSymbol,     States::Operator,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::Separator,         States::IllegalSymbol,     States::Separator,         States::Operator,          States::Identifier,        States::IllegalSymbol,     States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::BeginMultilineComment,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::EndOfFile,            },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Bin,               States::Bin,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Whitespace,           States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::Dollar,            States::Percent,           States::Ampersand,         States::StringStart,       States::LeftParenthesis,   States::Separator,         States::OperatorMult,           States::OperatorPlus,      States::Separator,         States::OperatorPlus,      States::OperatorDot,       States::Slash,             States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Colon,             States::Separator,         States::OperatorLess,      States::Operator,          States::OperatorGreater,   States::IllegalSymbol,     States::Operator,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::Separator,         States::IllegalSymbol,     States::Separator,         States::Operator,          States::Identifier,        States::IllegalSymbol,     States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::BeginMultilineComment,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::EndOfFile,            },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::Identifier,        States::IllegalSymbol,     States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,        States::IllegalSymbol,        States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,        States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,        States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::Separator,         States::IllegalSymbol,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::OperatorDot,       States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,  States::IllegalSymbol,        },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::Bin,               States::Bin,               States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::Oct,               States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::Identifier,        States::IllegalSymbol,     States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::Identifier,        States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::FloatingPoint,     States::TokenEnd,          States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::Decimal,           States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::FloatExp,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::LookBack,          States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::LookBack,          States::UnexpectedSymbol,  States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::Float,             States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::FloatExp,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::FloatExpSign,      States::UnexpectedSymbol,  States::FloatExpSign,      States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::ScaleFactorExpected,  States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::FloatEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::Hex,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::String,               States::EOLnWhileReading,     States::IllegalSymbol,  States::IllegalSymbol,  States::EOLnWhileReading,     States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::String,               States::String,         States::String,         States::String,            States::String,            States::String,            States::String,            States::StringEnd,         States::String,            States::String,            States::String,                 States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,                 States::String,            States::String,            States::String,            States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::String,               States::EOLnWhileReading,     States::IllegalSymbol,  States::IllegalSymbol,  States::EOLnWhileReading,     States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::String,               States::String,         States::String,         States::String,            States::String,            States::String,            States::String,            States::StringEnd,         States::String,            States::String,            States::String,                 States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,            States::String,                 States::String,            States::String,            States::String,            States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::String,            States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::NumberExpected,       States::IllegalSymbol,  States::IllegalSymbol,  States::UnexpectedSymbol,  States::HexCharCode,       States::BinCharCode,       States::OctCharCode,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,       States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::StringStart,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::DecimalCharCode,   States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::StringStart,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::BinCharCode,       States::BinCharCode,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::StringStart,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::HexCharCode,       States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::ControlString,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::StringStart,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::OctCharCode,       States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::UnexpectedSymbol,  States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Separator,         States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::Operator,          States::Operator,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::Operator,          States::Operator,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::BeginComment,      States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Operator,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,             States::IllegalSymbol,  States::IllegalSymbol,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::BeginMultilineComment,  States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::Separator,         States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::IllegalSymbol,     States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::IllegalSymbol,     States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,          States::TokenEnd,               States::IllegalSymbol,     States::UnexpectedSymbol,  States::IllegalSymbol,     States::IllegalSymbol,  States::TokenEnd,             },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,              States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,              States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,                States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,                States::Comment,           States::Comment,           States::Comment,           States::IllegalSymbol,  States::EndOfFile,            },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,              States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::NewLine,              States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,              States::IllegalSymbol,  States::IllegalSymbol,  States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,                States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,           States::Comment,                States::Comment,           States::Comment,           States::Comment,           States::IllegalSymbol,  States::EndOfFile,            },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::Asterisk,               States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,       States::MultilineComment,  States::Whitespace,        States::MultilineComment,  States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::Asterisk,               States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,       States::MultilineComment,  States::Whitespace,        States::MultilineComment,  States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::Asterisk,               States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,       States::MultilineComment,  States::Whitespace,        States::MultilineComment,  States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-        {  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::CommentNewLine,       States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,     States::IllegalSymbol,  States::IllegalSymbol,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::Whitespace,        States::MultilineComment,       States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,  States::MultilineComment,       States::MultilineComment,  States::Whitespace,        States::MultilineComment,  States::IllegalSymbol,  States::UnexpectedEndOfFile,  },
-	};
-}
+#pragma once
+#include <array>
+
+// The lexer's DFA. It is written down below as a spec (which characters take each state
+// where) and expanded at compile time into the dense tables next() walks: characters
+// that every state treats alike share a class, the table has a column per class.
+namespace FiniteAutomata {
+    enum class States : unsigned char {
+        TokenEnd,
+        Whitespace,
+        Bin,
+        NewLine,
+        Identifier,
+        LookBack,
+        Percent,
+        Dollar,
+        Oct,
+        Ampersand,
+        Decimal,
+        FloatingPoint,
+        Float,
+        FloatExp,
+        FloatExpSign,
+        FloatEnd,
+        Hex,
+        String,
+        StringStart,
+        StringEnd,
+        ControlString,
+        DecimalCharCode,
+        BinCharCode,
+        HexCharCode,
+        OctCharCode,
+        Operator,           // complete, e.g. ";" or ":=", only a token end follows
+        OperatorDot,
+        OperatorCompare,    // "<" or ">"
+        OperatorMult,
+        OperatorAssign,     // ":", "+" or "-", may take a "="
+        Slash,
+        LeftParenthesis,
+        BeginComment,
+        Comment,
+        BeginMultilineComment,
+        MultilineComment,
+        CommentNewLine,
+        Asterisk,
+        Amount,
+        EndOfFile,
+        IllegalSymbol,
+        UnexpectedSymbol,
+        EOLnWhileReading,
+        UnexpectedEndOfFile,
+        ScaleFactorExpected,
+        NumberExpected,
+        ConstantOutOfRange,
+    };
+
+    // How LexicalAnalyzer::scan and the Token constructor treat a state. States sharing a
+    // role are told apart only by their transitions, see MinimalStates.
+    enum class Roles : unsigned char {
+        Unique,             // handled on its own
+        Word,               // ends an identifier, keyword or operator, looked up by its text
+        Float,              // ends a float constant
+        Pending,            // can't end a token: "%", "$", "&", "1e", "1e+"
+        StringBegin,        // "'" or "#" opening a literal or a part of it
+        CommentBegin,
+    };
+
+    // Transitions are given on folded characters: letters are lower case and every byte of a
+    // UTF-8 sequence is NonAsciiChar. The end of file isn't a byte, atEnd() takes it.
+    static const unsigned int EndOfFileChar = 128;
+    static const unsigned int NonAsciiChar = 129;
+
+    constexpr unsigned char fold(unsigned char byte) {
+        unsigned int c = byte == 0 ? 1 : byte < 128 ? byte : NonAsciiChar;
+        return static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c + 'a' - 'A' : c);
+    };
+
+    struct State_t {
+        States state;
+        Roles role;
+        States otherwise;
+        States atEndOfFile;
+        // besides the control characters, which are illegal everywhere
+        const char* illegal;
+    };
+
+    struct Rule_t {
+        States from;
+        const char* on;
+        States to;
+    };
+
+    static constexpr char Blank[] = "\t ";
+    static constexpr char LineBreak[] = "\n\r";
+    static constexpr char Control[] = "\x01\x02\x03\x04\x05\x06\x07\x08\x0b\x0c\x0e\x0f\x10\x11\x12\x13"
+                                      "\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f\x7f";
+    // characters with no meaning outside of strings and comments, UTF-8 included
+    static constexpr char Stray[] = "!\"?\\`|~\x80";
+    static constexpr char Digits[] = "0123456789";
+    static constexpr char HexDigits[] = "0123456789abcdef";
+    static constexpr char Letters[] = "_abcdefghijklmnopqrstuvwxyz";
+
+    static constexpr State_t spec[] = {
+        // state                          role                  otherwise                  at end of file                     illegal
+        { States::TokenEnd,              Roles::Unique,       States::IllegalSymbol,    States::EndOfFile,           Stray },
+        { States::Whitespace,            Roles::Unique,       States::IllegalSymbol,    States::EndOfFile,           Stray },
+        { States::NewLine,               Roles::Unique,       States::IllegalSymbol,    States::EndOfFile,           Stray },
+        { States::Identifier,            Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::LookBack,              Roles::Unique,       States::IllegalSymbol,    States::IllegalSymbol,       ""    },
+        { States::Percent,               Roles::Pending,      States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::Dollar,                Roles::Pending,      States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::Ampersand,             Roles::Pending,      States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::Bin,                   Roles::Unique,       States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::Oct,                   Roles::Unique,       States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::Decimal,               Roles::Unique,       States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::Hex,                   Roles::Unique,       States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::FloatingPoint,         Roles::Float,        States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::Float,                 Roles::Float,        States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::FloatExp,              Roles::Pending,      States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::FloatExpSign,          Roles::Pending,      States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::FloatEnd,              Roles::Float,        States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::StringStart,           Roles::StringBegin,  States::String,           States::UnexpectedEndOfFile, ""    },
+        { States::String,                Roles::Unique,       States::String,           States::UnexpectedEndOfFile, ""    },
+        { States::StringEnd,             Roles::Unique,       States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::ControlString,         Roles::StringBegin,  States::UnexpectedSymbol, States::UnexpectedEndOfFile, Stray },
+        { States::DecimalCharCode,       Roles::Unique,       States::IllegalSymbol,    States::TokenEnd,            Stray },
+        { States::BinCharCode,           Roles::Unique,       States::IllegalSymbol,    States::TokenEnd,            Stray },
+        { States::HexCharCode,           Roles::Unique,       States::IllegalSymbol,    States::TokenEnd,            Stray },
+        { States::OctCharCode,           Roles::Unique,       States::IllegalSymbol,    States::TokenEnd,            Stray },
+        { States::Operator,              Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::OperatorDot,           Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::OperatorCompare,       Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::OperatorMult,          Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::OperatorAssign,        Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::Slash,                 Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::LeftParenthesis,       Roles::Word,         States::TokenEnd,         States::TokenEnd,            Stray },
+        { States::BeginComment,          Roles::CommentBegin, States::Comment,          States::EndOfFile,           "!\"" },
+        { States::Comment,               Roles::Unique,       States::Comment,          States::EndOfFile,           "!\"" },
+        { States::BeginMultilineComment, Roles::CommentBegin, States::MultilineComment, States::UnexpectedEndOfFile, "!\"" },
+        { States::MultilineComment,      Roles::Unique,       States::MultilineComment, States::UnexpectedEndOfFile, "!\"" },
+        { States::CommentNewLine,        Roles::Unique,       States::MultilineComment, States::UnexpectedEndOfFile, "!\"" },
+        { States::Asterisk,              Roles::Unique,       States::MultilineComment, States::UnexpectedEndOfFile, "!\"" },
+    };
+
+    static constexpr Rule_t rules[] = {
+        // between tokens
+        { States::TokenEnd,              Blank,                          States::Whitespace            },
+        { States::TokenEnd,              LineBreak,                      States::NewLine               },
+        { States::TokenEnd,              Letters,                        States::Identifier            },
+        { States::TokenEnd,              Digits,                         States::Decimal               },
+        { States::TokenEnd,              "%",                            States::Percent               },
+        { States::TokenEnd,              "$",                            States::Dollar                },
+        { States::TokenEnd,              "&",                            States::Ampersand             },
+        { States::TokenEnd,              "'",                            States::StringStart           },
+        { States::TokenEnd,              "#",                            States::ControlString         },
+        { States::TokenEnd,              "),;[]=@^",                     States::Operator              },
+        { States::TokenEnd,              ".",                            States::OperatorDot           },
+        { States::TokenEnd,              "<>",                           States::OperatorCompare       },
+        { States::TokenEnd,              "*",                            States::OperatorMult          },
+        { States::TokenEnd,              ":+-",                          States::OperatorAssign        },
+        { States::TokenEnd,              "/",                            States::Slash                 },
+        { States::TokenEnd,              "(",                            States::LeftParenthesis       },
+        { States::TokenEnd,              "{",                            States::BeginMultilineComment },
+        { States::TokenEnd,              "}",                            States::UnexpectedSymbol      },
+        { States::Whitespace,            Blank,                          States::Whitespace            },
+        { States::Whitespace,            LineBreak,                      States::NewLine               },
+        { States::Whitespace,            Letters,                        States::Identifier            },
+        { States::Whitespace,            Digits,                         States::Decimal               },
+        { States::Whitespace,            "%",                            States::Percent               },
+        { States::Whitespace,            "$",                            States::Dollar                },
+        { States::Whitespace,            "&",                            States::Ampersand             },
+        { States::Whitespace,            "'",                            States::StringStart           },
+        { States::Whitespace,            "#",                            States::ControlString         },
+        { States::Whitespace,            "),;[]=@^",                     States::Operator              },
+        { States::Whitespace,            ".",                            States::OperatorDot           },
+        { States::Whitespace,            "<>",                           States::OperatorCompare       },
+        { States::Whitespace,            "*",                            States::OperatorMult          },
+        { States::Whitespace,            ":+-",                          States::OperatorAssign        },
+        { States::Whitespace,            "/",                            States::Slash                 },
+        { States::Whitespace,            "(",                            States::LeftParenthesis       },
+        { States::Whitespace,            "{",                            States::BeginMultilineComment },
+        { States::Whitespace,            "}",                            States::UnexpectedSymbol      },
+        { States::NewLine,               Blank,                          States::Whitespace            },
+        { States::NewLine,               LineBreak,                      States::NewLine               },
+        { States::NewLine,               Letters,                        States::Identifier            },
+        { States::NewLine,               Digits,                         States::Decimal               },
+        { States::NewLine,               "%",                            States::Percent               },
+        { States::NewLine,               "$",                            States::Dollar                },
+        { States::NewLine,               "&",                            States::Ampersand             },
+        { States::NewLine,               "'",                            States::StringStart           },
+        { States::NewLine,               "#",                            States::ControlString         },
+        { States::NewLine,               "),;[]=@^",                     States::Operator              },
+        { States::NewLine,               ".",                            States::OperatorDot           },
+        { States::NewLine,               "<>",                           States::OperatorCompare       },
+        { States::NewLine,               "*",                            States::OperatorMult          },
+        { States::NewLine,               ":+-",                          States::OperatorAssign        },
+        { States::NewLine,               "/",                            States::Slash                 },
+        { States::NewLine,               "(",                            States::LeftParenthesis       },
+        { States::NewLine,               "{",                            States::BeginMultilineComment },
+        { States::NewLine,               "}",                            States::UnexpectedSymbol      },
+
+        // identifiers, keywords and operators
+        { States::Identifier,            Letters,                        States::Identifier            },
+        { States::Identifier,            Digits,                         States::Identifier            },
+        { States::Identifier,            "}",                            States::UnexpectedSymbol      },
+        { States::Operator,              "}",                            States::UnexpectedSymbol      },
+        { States::OperatorDot,           ")",                            States::Operator              },
+        { States::OperatorDot,           ".",                            States::Operator              },
+        { States::OperatorDot,           "}",                            States::UnexpectedSymbol      },
+        { States::OperatorCompare,       "<=>",                          States::Operator              },
+        { States::OperatorCompare,       "}",                            States::UnexpectedSymbol      },
+        { States::OperatorMult,          "*=",                           States::Operator              },
+        { States::OperatorMult,          "}",                            States::UnexpectedSymbol      },
+        { States::OperatorAssign,        "=",                            States::Operator              },
+        { States::OperatorAssign,        "}",                            States::UnexpectedSymbol      },
+        { States::Slash,                 "=",                            States::Operator              },
+        { States::Slash,                 "/",                            States::BeginComment          },
+        { States::Slash,                 "}",                            States::UnexpectedSymbol      },
+        { States::LeftParenthesis,       ".",                            States::Operator              },
+        { States::LeftParenthesis,       "*",                            States::BeginMultilineComment },
+        { States::LeftParenthesis,       "}",                            States::UnexpectedSymbol      },
+
+        // integers: %binary, &octal, $hex, decimal
+        { States::Percent,               Blank,                          States::NumberExpected        },
+        { States::Percent,               LineBreak,                      States::NumberExpected        },
+        { States::Percent,               "01",                           States::Bin                   },
+        { States::Dollar,                Blank,                          States::NumberExpected        },
+        { States::Dollar,                LineBreak,                      States::NumberExpected        },
+        { States::Dollar,                HexDigits,                      States::Hex                   },
+        { States::Ampersand,             Blank,                          States::NumberExpected        },
+        { States::Ampersand,             LineBreak,                      States::NumberExpected        },
+        { States::Ampersand,             "01234567",                     States::Oct                   },
+        { States::Ampersand,             Letters,                        States::Identifier            },
+        { States::Bin,                   "01",                           States::Bin                   },
+        { States::Bin,                   "}",                            States::UnexpectedSymbol      },
+        { States::Oct,                   "01234567",                     States::Oct                   },
+        { States::Oct,                   "}",                            States::UnexpectedSymbol      },
+        { States::Hex,                   HexDigits,                      States::Hex                   },
+        { States::Hex,                   "}",                            States::UnexpectedSymbol      },
+        { States::Decimal,               Digits,                         States::Decimal               },
+        { States::Decimal,               ".",                            States::FloatingPoint         },
+        { States::Decimal,               "e",                            States::FloatExp              },
+        { States::Decimal,               "}",                            States::UnexpectedSymbol      },
+
+        // floats; "1.." and "1.)" give the dot back, see LookBack
+        { States::FloatingPoint,         Blank,                          States::TokenEnd              },
+        { States::FloatingPoint,         LineBreak,                      States::TokenEnd              },
+        { States::FloatingPoint,         Digits,                         States::Float                 },
+        { States::FloatingPoint,         ".)",                           States::LookBack              },
+        { States::LookBack,              ")",                            States::Operator              },
+        { States::LookBack,              ".",                            States::OperatorDot           },
+        { States::Float,                 Digits,                         States::Float                 },
+        { States::Float,                 "e",                            States::FloatExp              },
+        { States::Float,                 "}",                            States::UnexpectedSymbol      },
+        { States::FloatExp,              Blank,                          States::ScaleFactorExpected   },
+        { States::FloatExp,              LineBreak,                      States::ScaleFactorExpected   },
+        { States::FloatExp,              "+-",                           States::FloatExpSign          },
+        { States::FloatExp,              Digits,                         States::FloatEnd              },
+        { States::FloatExpSign,          Blank,                          States::ScaleFactorExpected   },
+        { States::FloatExpSign,          LineBreak,                      States::ScaleFactorExpected   },
+        { States::FloatExpSign,          Digits,                         States::FloatEnd              },
+        { States::FloatEnd,              Digits,                         States::FloatEnd              },
+        { States::FloatEnd,              "}",                            States::UnexpectedSymbol      },
+
+        // string literals: quoted parts and #codes, e.g. 'a'#13#$0A'b'
+        { States::StringStart,           LineBreak,                      States::EOLnWhileReading      },
+        { States::StringStart,           "'",                            States::StringEnd             },
+        { States::String,                LineBreak,                      States::EOLnWhileReading      },
+        { States::String,                "'",                            States::StringEnd             },
+        { States::StringEnd,             "'",                            States::String                },
+        { States::StringEnd,             "#",                            States::ControlString         },
+        { States::StringEnd,             "}",                            States::UnexpectedSymbol      },
+        { States::ControlString,         Blank,                          States::NumberExpected        },
+        { States::ControlString,         LineBreak,                      States::NumberExpected        },
+        { States::ControlString,         Digits,                         States::DecimalCharCode       },
+        { States::ControlString,         "%",                            States::BinCharCode           },
+        { States::ControlString,         "$",                            States::HexCharCode           },
+        { States::ControlString,         "&",                            States::OctCharCode           },
+        { States::DecimalCharCode,       Digits,                         States::DecimalCharCode       },
+        { States::DecimalCharCode,       "abcdefghijklmnopqrstuvwxyz}",  States::UnexpectedSymbol      },
+        { States::BinCharCode,           "01",                           States::BinCharCode           },
+        { States::BinCharCode,           "23456789abcdefghijklmnopqrstuvwxyz}", States::UnexpectedSymbol },
+        { States::HexCharCode,           HexDigits,                      States::HexCharCode           },
+        { States::HexCharCode,           "ghijklmnopqrstuvwxyz}",        States::UnexpectedSymbol      },
+        { States::OctCharCode,           Digits,                         States::OctCharCode           },
+        { States::OctCharCode,           "abcdefghijklmnopqrstuvwxyz}",  States::UnexpectedSymbol      },
+        { States::DecimalCharCode,       Blank,                          States::TokenEnd              },
+        { States::DecimalCharCode,       LineBreak,                      States::TokenEnd              },
+        { States::DecimalCharCode,       "$%&()*+,-./:;<=>@[]^_{",       States::TokenEnd              },
+        { States::DecimalCharCode,       "#",                            States::ControlString         },
+        { States::DecimalCharCode,       "'",                            States::StringStart           },
+        { States::BinCharCode,           Blank,                          States::TokenEnd              },
+        { States::BinCharCode,           LineBreak,                      States::TokenEnd              },
+        { States::BinCharCode,           "$%&()*+,-./:;<=>@[]^_{",       States::TokenEnd              },
+        { States::BinCharCode,           "#",                            States::ControlString         },
+        { States::BinCharCode,           "'",                            States::StringStart           },
+        { States::HexCharCode,           Blank,                          States::TokenEnd              },
+        { States::HexCharCode,           LineBreak,                      States::TokenEnd              },
+        { States::HexCharCode,           "$%&()*+,-./:;<=>@[]^_{",       States::TokenEnd              },
+        { States::HexCharCode,           "#",                            States::ControlString         },
+        { States::HexCharCode,           "'",                            States::StringStart           },
+        { States::OctCharCode,           Blank,                          States::TokenEnd              },
+        { States::OctCharCode,           LineBreak,                      States::TokenEnd              },
+        { States::OctCharCode,           "$%&()*+,-./:;<=>@[]^_{",       States::TokenEnd              },
+        { States::OctCharCode,           "#",                            States::ControlString         },
+        { States::OctCharCode,           "'",                            States::StringStart           },
+
+        // comments: // to the end of the line, { } and (* *) across lines
+        { States::BeginComment,          LineBreak,                      States::NewLine               },
+        { States::Comment,               LineBreak,                      States::NewLine               },
+        { States::BeginMultilineComment, LineBreak,                      States::CommentNewLine        },
+        { States::BeginMultilineComment, "*",                            States::Asterisk              },
+        { States::BeginMultilineComment, "}",                            States::Whitespace            },
+        { States::MultilineComment,      LineBreak,                      States::CommentNewLine        },
+        { States::MultilineComment,      "*",                            States::Asterisk              },
+        { States::MultilineComment,      "}",                            States::Whitespace            },
+        { States::CommentNewLine,        LineBreak,                      States::CommentNewLine        },
+        { States::CommentNewLine,        "*",                            States::Asterisk              },
+        { States::CommentNewLine,        "}",                            States::Whitespace            },
+        { States::Asterisk,              LineBreak,                      States::CommentNewLine        },
+        { States::Asterisk,              ")}",                           States::Whitespace            },
+    };
+
+    static const unsigned int RowStates = static_cast<unsigned int>(States::Amount);
+    static const unsigned int AllStates = static_cast<unsigned int>(States::ConstantOutOfRange) + 1;
+    // folded characters are 1..129
+    static const unsigned int FoldedAmount = NonAsciiChar + 1;
+
+    constexpr unsigned int row(States state) { return static_cast<unsigned int>(state); };
+    constexpr unsigned int folded(char c) { return fold(static_cast<unsigned char>(c)); };
+
+    // The spec as a state x folded character table
+    struct Expanded_t {
+        States next[RowStates][FoldedAmount];
+        unsigned int described[RowStates];
+        unsigned int conflicts;
+    };
+
+    constexpr Expanded_t expand() {
+        Expanded_t result = {};
+        bool given[RowStates][FoldedAmount] = {};
+        for (const State_t& s : spec) {
+            unsigned int r = row(s.state);
+            ++result.described[r];
+            for (unsigned int c = 1; c < FoldedAmount; ++c)
+                result.next[r][c] = c == EndOfFileChar ? s.atEndOfFile : s.otherwise;
+            for (const char* illegal : { Control, s.illegal })
+                for (const char* c = illegal; *c; ++c) {
+                    result.conflicts += given[r][folded(*c)];
+                    given[r][folded(*c)] = true;
+                    result.next[r][folded(*c)] = States::IllegalSymbol;
+                };
+        };
+        for (const Rule_t& rule : rules)
+            for (const char* c = rule.on; *c; ++c) {
+                unsigned int r = row(rule.from);
+                result.conflicts += given[r][folded(*c)];
+                given[r][folded(*c)] = true;
+                result.next[r][folded(*c)] = rule.to;
+            };
+        return result;
+    };
+
+    static constexpr Expanded_t expanded = expand();
+
+    constexpr bool describedOnce() {
+        for (unsigned int count : expanded.described)
+            if (count != 1)
+                return false;
+        return true;
+    };
+
+    static_assert(describedOnce(), "every state below Amount needs exactly one entry in spec");
+    static_assert(expanded.conflicts == 0, "a state is given two transitions on one character");
+
+    // Folded characters with the same column in every state are one class, numbered by
+    // their first character. No byte is in the end of file's class.
+    struct Classes_t {
+        std::array<unsigned char, 256> of;
+        unsigned char first[FoldedAmount];
+        unsigned int amount;
+        unsigned char endOfFile;
+    };
+
+    constexpr bool sameColumn(unsigned int a, unsigned int b) {
+        for (unsigned int r = 0; r < RowStates; ++r)
+            if (expanded.next[r][a] != expanded.next[r][b])
+                return false;
+        return true;
+    };
+
+    constexpr Classes_t classify() {
+        Classes_t result = {};
+        unsigned char byFolded[FoldedAmount] = {};
+        unsigned long long hash[FoldedAmount] = {};
+        for (unsigned int c = 1; c < FoldedAmount; ++c) {
+            if (c >= 'A' && c <= 'Z')
+                continue;
+            for (unsigned int r = 0; r < RowStates; ++r)
+                hash[c] = hash[c] * 67 + row(expanded.next[r][c]);
+            unsigned int k = 0;
+            while (k < result.amount && (hash[result.first[k]] != hash[c] || !sameColumn(result.first[k], c)))
+                ++k;
+            if (k == result.amount)
+                result.first[result.amount++] = static_cast<unsigned char>(c);
+            byFolded[c] = static_cast<unsigned char>(k);
+        };
+        for (unsigned int b = 0; b < 256; ++b)
+            result.of[b] = byFolded[fold(static_cast<unsigned char>(b))];
+        result.endOfFile = byFolded[EndOfFileChar];
+        return result;
+    };
+
+    static constexpr Classes_t classified = classify();
+
+    static constexpr unsigned int ClassesAmount = classified.amount;
+    static constexpr unsigned char EndOfFileClass = classified.endOfFile;
+
+    // byte -> character class, case folding included
+    static constexpr std::array<unsigned char, 256> classes = classified.of;
+
+    typedef std::array<std::array<States, ClassesAmount>, RowStates> Table_t;
+
+    constexpr Table_t tabulate() {
+        Table_t result = {};
+        for (unsigned int r = 0; r < RowStates; ++r)
+            for (unsigned int k = 0; k < ClassesAmount; ++k)
+                result[r][k] = expanded.next[r][classified.first[k]];
+        return result;
+    };
+
+    static constexpr Table_t states = tabulate();
+
+    // Moore's algorithm. The lexer acts on the state it stops in, so states start out
+    // split by role (Unique ones and the error states each alone) and blocks are split by
+    // the blocks their transitions lead to until that changes nothing. Returns how many
+    // blocks the states below Amount end up in.
+    constexpr unsigned int minimalStates() {
+        unsigned int block[AllStates] = {};
+        unsigned int roleBlock[static_cast<unsigned int>(Roles::CommentBegin) + 1] = {};
+        unsigned int blocks = 0;
+        for (const State_t& s : spec) {
+            unsigned int& shared = roleBlock[static_cast<unsigned int>(s.role)];
+            if (s.role == Roles::Unique)
+                block[row(s.state)] = blocks++;
+            else
+                block[row(s.state)] = shared ? shared - 1 : (shared = ++blocks) - 1;
+        };
+        for (unsigned int s = RowStates; s < AllStates; ++s)
+            block[s] = blocks++;
+
+        while (true) {
+            unsigned long long hash[AllStates] = {};
+            unsigned int split[AllStates] = {};
+            for (unsigned int s = 0; s < RowStates; ++s)
+                for (unsigned int k = 0; k < ClassesAmount; ++k)
+                    hash[s] = hash[s] * 67 + block[row(states[s][k])];
+            unsigned int count = 0;
+            for (unsigned int s = 0; s < AllStates; ++s) {
+                unsigned int t = 0;
+                for (; t < s; ++t) {
+                    if (block[t] != block[s] || hash[t] != hash[s])
+                        continue;
+                    unsigned int k = 0;
+                    while (k < ClassesAmount && block[row(states[s][k])] == block[row(states[t][k])])
+                        ++k;
+                    if (k == ClassesAmount)
+                        break;
+                };
+                split[s] = t < s ? split[t] : count++;
+            };
+            if (count == blocks)
+                break;
+            blocks = count;
+            for (unsigned int s = 0; s < AllStates; ++s)
+                block[s] = split[s];
+        };
+        return blocks - (AllStates - RowStates);
+    };
+
+    static_assert(minimalStates() == RowStates, "two states the lexer can't tell apart, merge them");
+
+    inline States next(States state, char c) {
+        return states[static_cast<unsigned int>(state)][classes[static_cast<unsigned char>(c)]];
+    };
+
+    inline States atEnd(States state) {
+        return states[static_cast<unsigned int>(state)][EndOfFileClass];
+    };
+}
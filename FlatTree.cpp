@@ -0,0 +1,126 @@
+﻿#include "FlatTree.hpp"
+#include <algorithm>
+
+// Preorder without recursion: a node takes the next index when it is popped, and reserves
+// the edges to its children at once, so the edges of node n + 1 start where those of n end.
+// Each stack entry remembers the edge that waits for the index of its node. A node has been
+// seen if its _flatIndex leads back to it, which also holds up for a tree flattened twice.
+FlatTree::FlatTree(Node::PNode_t root) {
+    static_assert(static_cast<int>(Node::Type::DownTo) < 256, "Node::Type must fit _kinds");
+    if (!root)
+        return;
+    const size_t noEdge = static_cast<size_t>(-1);
+    std::vector<Node::PNode_t> nodes;
+    std::vector<std::pair<Node::PNode_t, size_t>> stack = { { root, noEdge } };
+    _tokens.push_back(Token());
+    while (!stack.empty()) {
+        Node::PNode_t node = stack.back().first;
+        size_t edge = stack.back().second;
+        stack.pop_back();
+        if (node->_flatIndex < nodes.size() && nodes[node->_flatIndex] == node) {
+            _edges[edge] = node->_flatIndex;
+            continue;
+        };
+        Index_t n = static_cast<Index_t>(_kinds.size());
+        node->_flatIndex = n;
+        nodes.push_back(node);
+        if (edge != noEdge)
+            _edges[edge] = n;
+
+        _kinds.push_back(static_cast<uint8_t>(node->_type));
+        // blocks, values and other nodes without a token of their own share entry 0
+        if (node->_token._subClass == Token::SubClass::EndOfFile && !node->_token._offset)
+            _tokenOf.push_back(0);
+        else {
+            _tokenOf.push_back(static_cast<Index_t>(_tokens.size()));
+            _tokens.push_back(node->_token);
+        };
+
+        size_t first = _edges.size();
+        _firstEdge.push_back(static_cast<Index_t>(first));
+        _edges.resize(first + node->_children.size());
+        for (size_t i = node->_children.size(); i-- > 0;)
+            stack.push_back({ node->_children[i], first + i });
+
+        if (const char* name = node->name())
+            _names.push_back({ n, name });
+        if (node->_type == Node::Type::Subrange)
+            _bounds.push_back({ n, { static_cast<Subrange*>(node)->_lowerBound, static_cast<Subrange*>(node)->_upperBound } });
+        else if (node->_type == Node::Type::Type)
+            _declares.push_back({ n, static_cast<uint8_t>(static_cast<TypeNode*>(node)->_type) });
+        else if (node->_type == Node::Type::Identifier) {
+            Identifier* identifier = dynamic_cast<Identifier*>(node);
+            if (identifier && identifier->isAssignment)
+                _assignments.push_back(n);
+        };
+    };
+    _firstEdge.push_back(static_cast<Index_t>(_edges.size()));
+    // the tree is never extended, drop what the vectors reserved for growth
+    _kinds.shrink_to_fit();
+    _tokenOf.shrink_to_fit();
+    _firstEdge.shrink_to_fit();
+    _edges.shrink_to_fit();
+    _tokens.shrink_to_fit();
+    _names.shrink_to_fit();
+    _bounds.shrink_to_fit();
+    _declares.shrink_to_fit();
+    _assignments.shrink_to_fit();
+};
+
+template<typename T>
+const T* FlatTree::find(const std::vector<std::pair<Index_t, T>>& table, Index_t n) {
+    auto i = std::lower_bound(table.begin(), table.end(), n, [](const std::pair<Index_t, T>& entry, Index_t n) { return entry.first < n; });
+    return i != table.end() && i->first == n ? &i->second : nullptr;
+};
+
+std::string FlatTree::toString(Index_t n) const {
+    if (const char* const* name = find(_names, n))
+        return *name;
+    return token(n).toString();
+};
+
+FlatTree::Bounds_t FlatTree::bounds(Index_t n) const {
+    const Bounds_t* entry = find(_bounds, n);
+    return entry ? *entry : Bounds_t(0, 0);
+};
+
+Node::Type FlatTree::declares(Index_t n) const {
+    const uint8_t* entry = find(_declares, n);
+    return entry ? static_cast<Node::Type>(*entry) : Node::Type::Type;
+};
+
+bool FlatTree::isAssignment(Index_t n) const {
+    return std::binary_search(_assignments.begin(), _assignments.end(), n);
+};
+
+size_t FlatTree::bytes() const {
+    return _kinds.capacity() * sizeof(uint8_t) +
+           (_tokenOf.capacity() + _firstEdge.capacity() + _edges.capacity() + _assignments.capacity()) * sizeof(Index_t) +
+           _tokens.capacity() * sizeof(Token) +
+           _names.capacity() * sizeof(_names[0]) +
+           _bounds.capacity() * sizeof(_bounds[0]) +
+           _declares.capacity() * sizeof(_declares[0]);
+};
+
+void FlatTree::log(std::wostream& os) const {
+    std::vector<std::pair<int, bool>> margins;
+    if (!empty())
+        log(os, root(), true, margins);
+};
+
+void FlatTree::log(std::wostream& os, Index_t n, bool isLastChild, std::vector<std::pair<int, bool>>& margins) const {
+    for (auto i : margins) {
+        if (i.second)
+            os << L'│';
+        for (auto j = 0; j < (i.first - i.second) - 1; ++j)
+            os << " ";
+    };
+    std::string text = toString(n);
+    os << (isLastChild ? L'└' : L'├') << L'─' << text.c_str() << std::endl;
+
+    for (auto i = beginChildren(n); i != endChildren(n); ++i) {
+        margins.push_back({ static_cast<int>(text.length()) + 2, !isLastChild });
+        log(os, *i, *i == *(endChildren(n) - 1), margins);
+        margins.pop_back();
+    };
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include "Node.hpp"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The syntax tree packed into columns indexed by node, in preorder from the program node 0.
+// The children of node n are _edges[_firstEdge[n]] .. _edges[_firstEdge[n + 1] - 1], so a
+// walk over a subtree mostly reads the columns front to back. A node the pointer tree shares
+// between parents (a declared type, an alias) is stored once and listed under each of them.
+// Data only a few kinds carry lives in side tables sorted by node.
+// Tokens still point into the source and the arena of the lexer that read them.
+class FlatTree {
+    public:
+        typedef uint32_t Index_t;
+        typedef std::pair<uint64_t, uint64_t> Bounds_t;
+
+        FlatTree() {};
+        explicit FlatTree(Node::PNode_t root);
+
+        size_t size() const { return _kinds.size(); };
+        bool empty() const { return _kinds.empty(); };
+        Index_t root() const { return 0; };
+
+        Node::Type kind(Index_t n) const { return static_cast<Node::Type>(_kinds[n]); };
+        const Token& token(Index_t n) const { return _tokens[_tokenOf[n]]; };
+        size_t childCount(Index_t n) const { return _firstEdge[n + 1] - _firstEdge[n]; };
+        Index_t child(Index_t n, size_t i) const { return _edges[_firstEdge[n] + i]; };
+        const Index_t* beginChildren(Index_t n) const { return _edges.data() + _firstEdge[n]; };
+        const Index_t* endChildren(Index_t n) const { return _edges.data() + _firstEdge[n + 1]; };
+        // Node::toString of the node the entry was made from
+        std::string toString(Index_t n) const;
+        // Bounds of a Subrange node
+        Bounds_t bounds(Index_t n) const;
+        // What a Type node declares: a variable, a constant or a type alias
+        Node::Type declares(Index_t n) const;
+        // Identifier::isAssignment
+        bool isAssignment(Index_t n) const;
+
+        // Memory held by the columns and side tables
+        size_t bytes() const;
+        // The same text Parser::log writes for the pointer tree
+        void log(std::wostream& os) const;
+
+    private:
+        template<typename T>
+        static const T* find(const std::vector<std::pair<Index_t, T>>& table, Index_t n);
+        void log(std::wostream& os, Index_t n, bool isLastChild, std::vector<std::pair<int, bool>>& margins) const;
+
+        std::vector<uint8_t> _kinds;
+        std::vector<Index_t> _tokenOf;
+        std::vector<Index_t> _firstEdge;
+        std::vector<Index_t> _edges;
+        std::vector<Token> _tokens;
+        std::vector<std::pair<Index_t, const char*>> _names;
+        std::vector<std::pair<Index_t, Bounds_t>> _bounds;
+        std::vector<std::pair<Index_t, uint8_t>> _declares;
+        std::vector<Index_t> _assignments;
+};
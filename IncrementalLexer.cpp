@@ -0,0 +1,160 @@
+#include "IncrementalLexer.hpp"
+#include <algorithm>
+
+IncrementalLexer::IncrementalLexer(std::string text) : _lines({ 0 }), _shiftFrom(0), _shift(0), _lineShiftFrom(1), _lineShift(0),
+                                                      _failed(false), _errorOffset(0), _errorState(FiniteAutomata::States::Amount) {
+    apply({ 0, 0, std::move(text) });
+};
+
+// Same line breaks the lexer counts rows on: every byte of the newline class, "\r\n" once
+bool IncrementalLexer::isLineStart(size_t at) const {
+    if (at == 0 || at > _text.size())
+        return false;
+    static const unsigned char newLine = FiniteAutomata::classes[static_cast<unsigned char>('\n')];
+    char c = _text[at - 1];
+    if (FiniteAutomata::classes[static_cast<unsigned char>(c)] != newLine)
+        return false;
+    return !(c == '\r' && at < _text.size() && _text[at] == '\n');
+};
+
+// Makes the pending token shift start at index to, touching only the tokens in between
+void IncrementalLexer::moveTokenShift(size_t to) {
+    for (size_t i = std::min(_shiftFrom, to); i < std::max(_shiftFrom, to) && i < _tokens.size(); ++i)
+        _tokens[i]._offset = static_cast<uint32_t>(_tokens[i]._offset + (_shiftFrom < to ? _shift : -_shift));
+    _shiftFrom = to;
+};
+
+void IncrementalLexer::moveLineShift(size_t to) {
+    for (size_t i = std::min(_lineShiftFrom, to); i < std::max(_lineShiftFrom, to) && i < _lines.size(); ++i)
+        _lines[i] = static_cast<uint32_t>(_lines[i] + (_lineShiftFrom < to ? _lineShift : -_lineShift));
+    _lineShiftFrom = to;
+};
+
+// A line start depends on the byte before it and the byte at it ("\r" + "\n"), so the
+// starts in [offset, offset + removed + 1] are dropped and recomputed on the new text
+void IncrementalLexer::updateLines(size_t offset, size_t removed, size_t inserted) {
+    size_t first = 1;
+    for (size_t count = _lines.size() - 1; count;) {
+        size_t half = count / 2;
+        if (lineStart(first + half) < offset) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    };
+    size_t last = first;
+    while (last < _lines.size() && lineStart(last) <= offset + removed + 1)
+        ++last;
+
+    moveLineShift(last);
+    _lineShift += static_cast<long long>(inserted) - static_cast<long long>(removed);
+    std::vector<uint32_t> starts;
+    for (size_t at = offset; at <= offset + inserted + 1 && at <= _text.size(); ++at)
+        if (isLineStart(at))
+            starts.push_back(static_cast<uint32_t>(at));
+    _lines.erase(_lines.begin() + first, _lines.begin() + last);
+    _lines.insert(_lines.begin() + first, starts.begin(), starts.end());
+    _lineShiftFrom = first + starts.size();
+};
+
+IncrementalLexer::Position_t IncrementalLexer::positionAt(size_t offset) const {
+    size_t line = 0;
+    for (size_t count = _lines.size(); count;) {
+        size_t half = count / 2;
+        if (lineStart(line + half) <= offset) {
+            line += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    };
+    return { static_cast<int>(line), static_cast<int>(offset - lineStart(line - 1) + 1) };
+};
+
+size_t IncrementalLexer::apply(const Edit_t& edit) {
+    size_t offset = std::min(edit.offset, _text.size());
+    size_t removed = std::min(edit.removed, _text.size() - offset);
+    long long delta = static_cast<long long>(edit.inserted.size()) - static_cast<long long>(removed);
+
+    // the first token that may change reads up to one byte past its end ("1..")
+    size_t first = 0;
+    for (size_t count = _tokens.size(); count;) {
+        size_t half = count / 2;
+        if (end(first + half) + 1 < offset) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    };
+    size_t start = first ? end(first - 1) : 0;
+
+    _text.replace(offset, removed, edit.inserted);
+    updateLines(offset, removed, edit.inserted.size());
+    if (_failed && _errorOffset >= offset + removed)
+        _errorOffset += delta;
+
+    const char* base = _text.data();
+    LexicalAnalyzer lexer(base, base + start, base + _text.size(), base + _text.size(),
+                          first ? FiniteAutomata::States::TokenEnd : FiniteAutomata::States::Whitespace);
+
+    // relex until a new token ends, past the edit, where an old one ended
+    std::vector<Token> tokens;
+    size_t resumeAt = _tokens.size();
+    bool resumed = false, failed = false;
+    try {
+        while (true) {
+            tokens.push_back(lexer.scan());
+            if (tokens.back()._subClass == Token::SubClass::EndOfFile)
+                break;
+            size_t newEnd = tokens.back()._offset + tokens.back()._length;
+            if (newEnd < offset + edit.inserted.size())
+                continue;
+            size_t oldEnd = newEnd - delta;
+            auto k = std::lower_bound(_tokens.begin() + first, _tokens.end(), oldEnd,
+                [this](const Token& t, size_t oldEnd) { return end(&t - _tokens.data()) < oldEnd; });
+            if (k != _tokens.end() && end(k - _tokens.begin()) == oldEnd && (*k)._subClass != Token::SubClass::EndOfFile) {
+                resumeAt = k - _tokens.begin() + 1;
+                resumed = true;
+                break;
+            };
+        };
+    }
+    catch (...) {
+        if (lexer._errorState == FiniteAutomata::States::Amount)
+            throw;
+        failed = true;
+        _errorState = lexer._errorState;
+        _errorOffset = lexer._errorOffset;
+    };
+    if (!resumed)
+        _failed = failed;
+    _arena.adopt(lexer._arena);
+
+    moveTokenShift(resumeAt);
+    _shift += delta;
+    _tokens.erase(_tokens.begin() + first, _tokens.begin() + resumeAt);
+    _tokens.insert(_tokens.begin() + first, tokens.begin(), tokens.end());
+    _shiftFrom = first + tokens.size();
+    return tokens.size();
+};
+
+Token IncrementalLexer::token(size_t i) const {
+    Token t = _tokens[i];
+    t._offset = static_cast<uint32_t>(offset(i));
+    // numbers point at their source text, which moves with the edits
+    if (t._subClass == Token::SubClass::IntConst || t._subClass == Token::SubClass::FloatConst)
+        t._value.s = _text.data() + t._offset;
+    return t;
+};
+
+std::string_view IncrementalLexer::raw(size_t i) const {
+    if (_tokens[i]._subClass == Token::SubClass::EndOfFile)
+        return LexicalAnalyzer::_eofText;
+    return std::string_view(_text.data() + offset(i), _tokens[i]._length);
+};
+
+std::string IncrementalLexer::error() const {
+    return _failed ? LexicalAnalyzer::errorMessage(positionAt(_errorOffset), _errorState) : "";
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include "LexicalAnalyzer.hpp"
+#include <string>
+#include <vector>
+
+// Token stream of an in-memory text that is kept up to date across edits. An edit is
+// re-lexed from the last token boundary before it until a new token ends where an old
+// one did (shifted by the edit); between tokens the DFA is always in TokenEnd, so from
+// there on the old tokens are still right and are spliced back in.
+// Offsets of the tokens and line starts past an edit are shifted lazily: one pending
+// (index, delta) per table, moved by each edit only over the entries between the old
+// and the new edit. Rows and columns come from the line-offset table, not the tokens.
+class IncrementalLexer {
+    public:
+        // Token's own kinds and positions, which only its friends can name
+        typedef Token::SubClass SubClass_t;
+        typedef Token::Position_t Position_t;
+
+        struct Edit_t {
+            size_t offset;
+            size_t removed;
+            std::string inserted;
+        };
+
+        IncrementalLexer(std::string text);
+
+        // Returns how many tokens had to be lexed again
+        size_t apply(const Edit_t& edit);
+
+        size_t size() const { return _tokens.size(); };
+        // The i-th token with its offset brought up to date, for friends of Token
+        Token token(size_t i) const;
+        // The i-th token's kind, its value as -l shows it and its source text
+        SubClass_t subClass(size_t i) const { return _tokens[i]._subClass; };
+        std::string text(size_t i) const { return token(i).toString(); };
+        std::string_view raw(size_t i) const;
+        // Where the i-th token starts in text(): its offset and its row and column. Entries
+        // before a pending shift may be stored below zero, so the offset wraps in 32 bits.
+        size_t offset(size_t i) const { return static_cast<uint32_t>(_tokens[i]._offset + (i >= _shiftFrom ? _shift : 0)); };
+        Position_t position(size_t i) const { return positionAt(offset(i)); };
+        Position_t positionAt(size_t offset) const;
+        const std::string& text() const { return _text; };
+        // Lexing stops at the first error like the sequential lexer does, "" if there is none
+        std::string error() const;
+
+    private:
+        size_t end(size_t i) const { return offset(i) + _tokens[i]._length; };
+        size_t lineStart(size_t i) const { return static_cast<uint32_t>(_lines[i] + (i >= _lineShiftFrom ? _lineShift : 0)); };
+        bool isLineStart(size_t at) const;
+        void moveTokenShift(size_t to);
+        void moveLineShift(size_t to);
+        void updateLines(size_t offset, size_t removed, size_t inserted);
+
+        std::string _text;
+        std::vector<Token> _tokens;
+        std::vector<uint32_t> _lines;
+        size_t _shiftFrom;
+        long long _shift;
+        size_t _lineShiftFrom;
+        long long _lineShift;
+        bool _failed;
+        size_t _errorOffset;
+        FiniteAutomata::States _errorState;
+        Arena _arena;
+};
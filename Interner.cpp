@@ -0,0 +1,40 @@
+#include "Interner.hpp"
+
+std::deque<std::string> Interner::_storage = {};
+std::vector<std::string_view> Interner::_names = {};
+std::unordered_map<std::string_view, Interner::Symbol_t> Interner::_symbols = {};
+std::mutex Interner::_mutex;
+
+// deque never relocates its elements, so the views kept in _names and _symbols stay valid.
+// Ids never change once given out, so each thread caches the ones it has seen and only
+// takes the lock for names that are new to it.
+Interner::Symbol_t Interner::intern(std::string_view name) {
+    thread_local std::unordered_map<std::string_view, Symbol_t> seen;
+    auto cached = seen.find(name);
+    if (cached != seen.end())
+        return cached->second;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Symbol_t symbol;
+    auto it = _symbols.find(name);
+    if (it != _symbols.end())
+        symbol = it->second;
+    else {
+        _storage.emplace_back(name);
+        symbol = static_cast<Symbol_t>(_names.size());
+        _names.push_back(_storage.back());
+        _symbols.insert({ _names.back(), symbol });
+    };
+    seen.insert({ _names[symbol], symbol });
+    return symbol;
+};
+
+std::string_view Interner::name(Symbol_t symbol) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _names[symbol];
+};
+
+size_t Interner::size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _names.size();
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Process-wide identifier table. Every distinct (lowercased) identifier gets a stable
+// 32-bit id at lex time; tokens, nodes and symbol tables compare ids instead of strings.
+// Safe to use from several lexer threads at once.
+class Interner {
+    public:
+        typedef uint32_t Symbol_t;
+        static const Symbol_t NoSymbol = 0xFFFFFFFF;
+
+        static Symbol_t intern(std::string_view name);
+        static std::string_view name(Symbol_t symbol);
+        static size_t size();
+
+    private:
+        static std::deque<std::string> _storage;
+        static std::vector<std::string_view> _names;
+        static std::unordered_map<std::string_view, Symbol_t> _symbols;
+        static std::mutex _mutex;
+};
@@ -1,315 +1,519 @@
-#pragma once
-#include "LexicalAnalyzer.hpp"
-
-const LexicalAnalyzer::ClassDict_t LexicalAnalyzer::_classDict = {
-    { Token::Class::ReservedWord,        "Reserved word"  },
-    { Token::Class::Identifier,          "Identifier"     },
-    { Token::Class::Operator,            "Operator"       },
-    { Token::Class::Separator,           "Separator"      },
-    { Token::Class::Constant,            "Constant"       },
-    { Token::Class::StringLiteral,       "String Literal" },
-};
-
-const LexicalAnalyzer::SubClassDict_t LexicalAnalyzer::_subClassDict = {
-   { Token::SubClass::Add,              "+"   },
-   { Token::SubClass::Sub,              "-"   },
-   { Token::SubClass::Mult,             "*"   },
-   { Token::SubClass::Div,              "/"   },
-   { Token::SubClass::Equal,            "="   },
-   { Token::SubClass::Less,             "<"   },
-   { Token::SubClass::More,             ">"   },
-   { Token::SubClass::Address,          "@"   },
-   { Token::SubClass::Pointer,          "^"   },
-   { Token::SubClass::Dot,              "."   },
-   { Token::SubClass::AddAssign,        "+="  },
-   { Token::SubClass::SubAssign,        "-="  },
-   { Token::SubClass::MultAssign,       "*="  },
-   { Token::SubClass::DivAssign,        "/="  },
-   { Token::SubClass::Assign,           ":="  },
-   { Token::SubClass::LEQ,              "<="  },
-   { Token::SubClass::MEQ,              ">="  },
-   { Token::SubClass::SHL,              "<<"  },
-   { Token::SubClass::SHR,              ">>"  },
-   { Token::SubClass::NEQ,              "<>"  },
-   { Token::SubClass::SymDiff,          "><"  },
-   { Token::SubClass::Exp,              "**"  },
-   { Token::SubClass::Subrange,            ".."  },
-   { Token::SubClass::And,              "and" },
-   { Token::SubClass::IntDiv,           "div" },
-   { Token::SubClass::Mod,              "mod" },
-   { Token::SubClass::Not,              "not" },
-   { Token::SubClass::SHL,              "shl" },
-   { Token::SubClass::SHR,              "shr" },
-   { Token::SubClass::Xor,              "xor" },
-
-   { Token::SubClass::Colon,            ":"  },
-   { Token::SubClass::Comma,            ","  },
-   { Token::SubClass::Semicolon,        ";"  },
-   { Token::SubClass::LeftBracket,      "["  },
-   { Token::SubClass::RightBracket,     "]"  },
-   { Token::SubClass::LeftBracket,      "(." },
-   { Token::SubClass::RightBracket,     ".)" },
-   { Token::SubClass::LeftParenthesis,  "("  },
-   { Token::SubClass::RightParenthesis, ")"  },
-
-   { Token::SubClass::Absolute,         "absolute"       },
-   { Token::SubClass::Array,            "array"          },
-   { Token::SubClass::Asm,              "asm"            },
-   { Token::SubClass::Begin,            "begin"          },
-   { Token::SubClass::Break,            "break"          },
-   { Token::SubClass::Case,             "case"           },
-   { Token::SubClass::Const,            "const"          },
-   { Token::SubClass::Constructor,      "constructor"    },
-   { Token::SubClass::Continue,         "continue"       },
-   { Token::SubClass::Destructor,       "destructor"     },
-   { Token::SubClass::Do,               "do"             },
-   { Token::SubClass::DownTo,           "downto"         },
-   { Token::SubClass::Else,             "else"           },
-   { Token::SubClass::End,              "end"            },
-   { Token::SubClass::False,            "false"          },
-   { Token::SubClass::File,             "file"           },
-   { Token::SubClass::For,              "for"            },
-   { Token::SubClass::Function,         "function"       },
-   { Token::SubClass::Goto,             "goto"           },
-   { Token::SubClass::If,               "if"             },
-   { Token::SubClass::Implementation,   "implementation" },
-   { Token::SubClass::In,               "in"             },
-   { Token::SubClass::Inline,           "inline"         },
-   { Token::SubClass::Interface,        "interface"      },
-   { Token::SubClass::Label,            "label"          },
-   { Token::SubClass::Nil,              "nil"            },
-   { Token::SubClass::Object,           "object"         },
-   { Token::SubClass::Of,               "of"             },
-   { Token::SubClass::Packed,           "packed"         },
-   { Token::SubClass::Procedure,        "procedure"      },
-   { Token::SubClass::Program,          "program"        },
-   { Token::SubClass::Record,           "record"         },
-   { Token::SubClass::Repeat,           "repeat"         },
-   { Token::SubClass::Set,              "set"            },
-   { Token::SubClass::String,           "string"         },
-   { Token::SubClass::Then,             "then"           },
-   { Token::SubClass::To,               "to"             },
-   { Token::SubClass::True,             "true"           },
-   { Token::SubClass::Type,             "type"           },
-   { Token::SubClass::Unit,             "unit"           },
-   { Token::SubClass::Until,            "until"          },
-   { Token::SubClass::Uses,             "uses"           },
-   { Token::SubClass::Var,              "var"            },
-   { Token::SubClass::While,            "while"          },
-   { Token::SubClass::With,             "with"           },
-   { Token::SubClass::IntConst,         "int const"      },
-   { Token::SubClass::FloatConst,       "float const"    },
-   { Token::SubClass::Identifier,       "identifier"     },
-   { Token::SubClass::StringLiteral,    "string literal" },
-   { Token::SubClass::EndOfFile,        "end of file"    },
-};
-
-LexicalAnalyzer::LexicalAnalyzer(const char* filename) : _currentState(FiniteAutomata::States::Whitespace), _row(1), _column(1) {
-    open(filename);
-};
-
-Token LexicalAnalyzer::currentToken() const {
-    return _currentToken;
-};
-
-Token LexicalAnalyzer::nextToken() {
-    char c;
-    std::string raw;
-    std::string val;
-    std::string code;
-    FiniteAutomata::States state;
-    while (!eof()) {
-        if (_file.eof())
-            c = 128;
-        else 
-            _file >> std::noskipws >> c;
-        state = FiniteAutomata::states[static_cast<unsigned int>(_currentState)][tolower(abs(c)) - 1];
-        switch (state) {
-        case FiniteAutomata::States::NewLine: 
-        case FiniteAutomata::States::CommentNewLine:
-            _column = 0;
-            ++_row;
-            break;
-        case FiniteAutomata::States::BeginComment:
-        case FiniteAutomata::States::BeginMultilineComment:
-            raw = val = "";
-        case FiniteAutomata::States::Whitespace:
-        case FiniteAutomata::States::Comment:
-        case FiniteAutomata::States::MultilineComment:
-        case FiniteAutomata::States::Asterisk:
-            break;
-        case FiniteAutomata::States::ControlString:
-        case FiniteAutomata::States::StringStart:
-            if (code.length()) {
-                val += codeToChar(_currentState, code);
-                code = "";
-            }
-        case FiniteAutomata::States::StringEnd:
-        case FiniteAutomata::States::Percent:
-        case FiniteAutomata::States::Dollar:
-        case FiniteAutomata::States::Ampersand:
-            raw += c;
-            break;
-        case FiniteAutomata::States::Identifier:
-            if (raw.length() && raw.back() == '&')
-                val += '&';
-            raw += c;
-            val += tolower(c);
-            break;
-        case FiniteAutomata::States::OperatorDot:
-        case FiniteAutomata::States::OperatorGreater:
-        case FiniteAutomata::States::OperatorLess:
-        case FiniteAutomata::States::OperatorMult:
-        case FiniteAutomata::States::OperatorPlus:
-        case FiniteAutomata::States::Operator:
-            raw += c;
-            val += tolower(c);
-            break;
-        case FiniteAutomata::States::DecimalCharCode:
-        case FiniteAutomata::States::BinCharCode:
-        case FiniteAutomata::States::OctCharCode:
-        case FiniteAutomata::States::HexCharCode:
-            if (c > '&')
-                code += c;
-            raw += c;
-            break;
-        case FiniteAutomata::States::Decimal:
-        case FiniteAutomata::States::Bin:
-        case FiniteAutomata::States::Oct:
-        case FiniteAutomata::States::Hex:
-        case FiniteAutomata::States::Float:
-        case FiniteAutomata::States::FloatingPoint:
-        case FiniteAutomata::States::FloatExp:
-        case FiniteAutomata::States::FloatExpSign:
-        case FiniteAutomata::States::FloatEnd:
-        case FiniteAutomata::States::String:
-        case FiniteAutomata::States::Separator:
-        case FiniteAutomata::States::Colon:
-        case FiniteAutomata::States::LeftParenthesis:
-        case FiniteAutomata::States::Slash:
-            raw += c;
-            val += c;
-            break;
-        case FiniteAutomata::States::LookBack:
-            --_column;
-            state = FiniteAutomata::States::TokenEnd;
-            _currentState = FiniteAutomata::States::Decimal;
-            _file.putback(c);
-            _file.putback(raw.back());
-            raw.pop_back();
-            val.pop_back();
-            goto token;
-        case FiniteAutomata::States::TokenEnd:
-            if (code.length()) {
-                val += codeToChar(_currentState, code);
-                code = "";
-            }
-            if (!_file.eof())
-                _file.putback(c);
-            goto token;
-        case FiniteAutomata::States::EndOfFile:
-            _currentState = state = FiniteAutomata::States::EndOfFile;
-            raw = val = "EOF";
-            _column += 3;
-            goto token;
-        default:
-            throwException({ _row, _column }, state);
-            break;
-        }
-        _file.peek();
-        ++_column;
-        _currentState = state;
-    }
-    token:
-    if (eof() && !val.length())
-        return _currentToken;
-    Token t(_currentState, { _row, _column - raw.length() }, raw, val);
-    _currentToken = t;
-    _currentState = state;
-    return t;
-
-};
-
-char LexicalAnalyzer::codeToChar(FiniteAutomata::States state, std::string code) {
-    char c;
-    switch (state) {
-    case FiniteAutomata::States::BinCharCode:
-        c = static_cast<char>(std::stoi(code, 0, 2));
-        break;
-    case FiniteAutomata::States::HexCharCode:
-        c = static_cast<char>(std::stoi(code, 0, 16));
-        break;
-    case FiniteAutomata::States::OctCharCode:
-        c = static_cast<char>(std::stoi(code, 0, 8));
-        break;
-    default:
-        c = static_cast<char>(std::stoi(code));
-        break;
-    }
-    return c;
-};
-
-void LexicalAnalyzer::log(std::ostream &os) {
-    std::list<Token> tokens;
-    try {
-        while (!eof())
-            tokens.push_back(nextToken());
-    } catch (std::exception e) {
-        os << e.what();
-        return;
-    };
-    for (Token t : tokens) {
-        std::stringstream pos, type, raw, val;
-        pos  << "(" << t._pos.first << ", " << t._pos.second << ")";
-        type << _classDict.at(t._class);
-        raw  << t._raw;
-        val  << t.toString();
-        os << pos.str()  << std::string(std::abs(static_cast<int>(20 - pos.str().length())), ' ') 
-           << type.str() << std::string(std::abs(static_cast<int>(20 - type.str().length())), ' ')
-           << raw.str()  << std::string(std::abs(static_cast<int>(30 - raw.str().length())), ' ')
-           << val.str()  << std::endl;
-    }
-};
-
-template<typename T>
-void LexicalAnalyzer::open(T filename) {
-    if (_file.is_open())
-        _file.close();
-    _file.open(filename);
-    _file.peek();
-};
-template void LexicalAnalyzer::open<const char*>(const char*);
-template void LexicalAnalyzer::open<const std::string&>(const std::string&);
-
-bool LexicalAnalyzer::eof() {
-    return _file.eof() && (_currentState == FiniteAutomata::States::EndOfFile);
-};
-void LexicalAnalyzer::throwException(Token::Position_t pos, FiniteAutomata::States state) {
-    std::stringstream ss;
-    ss << "(" << pos.first << ", " << pos.second << "): ";
-    switch (state) {
-    case FiniteAutomata::States::EOLnWhileReading:
-        ss << "Unexpected end of line";
-        break;
-    case FiniteAutomata::States::IllegalSymbol:
-        ss << "Illegal symbol";
-        break;
-    case FiniteAutomata::States::NumberExpected:
-        ss << "Number expected";
-        break;
-    case FiniteAutomata::States::ScaleFactorExpected:
-        ss << "Exponent scale factor expected";
-        break;
-    case FiniteAutomata::States::UnexpectedEndOfFile:
-        ss << "Unexpected end of file";
-        break;
-    case FiniteAutomata::States::UnexpectedSymbol:
-        ss << "Unexpected symbol";
-        break;
-    default:
-        throw std::exception("What a Terrible Failure");
-        break;
-    }
-
-    throw std::exception(ss.str().c_str());
+#pragma once
+#include "LexicalAnalyzer.hpp"
+#include "ParallelLexer.hpp"
+
+const char LexicalAnalyzer::_eofText[] = "EOF";
+const Token LexicalAnalyzer::_noToken;
+unsigned LexicalAnalyzer::_threads = 1;
+#ifdef LEXER_DIRECT_CODED
+LexicalAnalyzer::Engine LexicalAnalyzer::_engine = LexicalAnalyzer::Engine::Direct;
+#else
+LexicalAnalyzer::Engine LexicalAnalyzer::_engine = LexicalAnalyzer::Engine::Table;
+#endif
+
+const LexicalAnalyzer::ClassDict_t LexicalAnalyzer::_classDict = {
+    { Token::Class::ReservedWord,        "Reserved word"  },
+    { Token::Class::Identifier,          "Identifier"     },
+    { Token::Class::Operator,            "Operator"       },
+    { Token::Class::Separator,           "Separator"      },
+    { Token::Class::Constant,            "Constant"       },
+    { Token::Class::StringLiteral,       "String Literal" },
+};
+
+const LexicalAnalyzer::SubClassDict_t LexicalAnalyzer::_subClassDict = {
+   { Token::SubClass::Add,              "+"   },
+   { Token::SubClass::Sub,              "-"   },
+   { Token::SubClass::Mult,             "*"   },
+   { Token::SubClass::Div,              "/"   },
+   { Token::SubClass::Equal,            "="   },
+   { Token::SubClass::Less,             "<"   },
+   { Token::SubClass::More,             ">"   },
+   { Token::SubClass::Address,          "@"   },
+   { Token::SubClass::Pointer,          "^"   },
+   { Token::SubClass::Dot,              "."   },
+   { Token::SubClass::AddAssign,        "+="  },
+   { Token::SubClass::SubAssign,        "-="  },
+   { Token::SubClass::MultAssign,       "*="  },
+   { Token::SubClass::DivAssign,        "/="  },
+   { Token::SubClass::Assign,           ":="  },
+   { Token::SubClass::LEQ,              "<="  },
+   { Token::SubClass::MEQ,              ">="  },
+   { Token::SubClass::SHL,              "<<"  },
+   { Token::SubClass::SHR,              ">>"  },
+   { Token::SubClass::NEQ,              "<>"  },
+   { Token::SubClass::SymDiff,          "><"  },
+   { Token::SubClass::Exp,              "**"  },
+   { Token::SubClass::Subrange,            ".."  },
+   { Token::SubClass::And,              "and" },
+   { Token::SubClass::IntDiv,           "div" },
+   { Token::SubClass::Mod,              "mod" },
+   { Token::SubClass::Not,              "not" },
+   { Token::SubClass::SHL,              "shl" },
+   { Token::SubClass::SHR,              "shr" },
+   { Token::SubClass::Xor,              "xor" },
+
+   { Token::SubClass::Colon,            ":"  },
+   { Token::SubClass::Comma,            ","  },
+   { Token::SubClass::Semicolon,        ";"  },
+   { Token::SubClass::LeftBracket,      "["  },
+   { Token::SubClass::RightBracket,     "]"  },
+   { Token::SubClass::LeftBracket,      "(." },
+   { Token::SubClass::RightBracket,     ".)" },
+   { Token::SubClass::LeftParenthesis,  "("  },
+   { Token::SubClass::RightParenthesis, ")"  },
+
+   { Token::SubClass::Absolute,         "absolute"       },
+   { Token::SubClass::Array,            "array"          },
+   { Token::SubClass::Asm,              "asm"            },
+   { Token::SubClass::Begin,            "begin"          },
+   { Token::SubClass::Break,            "break"          },
+   { Token::SubClass::Case,             "case"           },
+   { Token::SubClass::Const,            "const"          },
+   { Token::SubClass::Constructor,      "constructor"    },
+   { Token::SubClass::Continue,         "continue"       },
+   { Token::SubClass::Destructor,       "destructor"     },
+   { Token::SubClass::Do,               "do"             },
+   { Token::SubClass::DownTo,           "downto"         },
+   { Token::SubClass::Else,             "else"           },
+   { Token::SubClass::End,              "end"            },
+   { Token::SubClass::False,            "false"          },
+   { Token::SubClass::File,             "file"           },
+   { Token::SubClass::For,              "for"            },
+   { Token::SubClass::Function,         "function"       },
+   { Token::SubClass::Goto,             "goto"           },
+   { Token::SubClass::If,               "if"             },
+   { Token::SubClass::Implementation,   "implementation" },
+   { Token::SubClass::In,               "in"             },
+   { Token::SubClass::Inline,           "inline"         },
+   { Token::SubClass::Interface,        "interface"      },
+   { Token::SubClass::Label,            "label"          },
+   { Token::SubClass::Nil,              "nil"            },
+   { Token::SubClass::Object,           "object"         },
+   { Token::SubClass::Of,               "of"             },
+   { Token::SubClass::Packed,           "packed"         },
+   { Token::SubClass::Procedure,        "procedure"      },
+   { Token::SubClass::Program,          "program"        },
+   { Token::SubClass::Record,           "record"         },
+   { Token::SubClass::Repeat,           "repeat"         },
+   { Token::SubClass::Set,              "set"            },
+   { Token::SubClass::String,           "string"         },
+   { Token::SubClass::Then,             "then"           },
+   { Token::SubClass::To,               "to"             },
+   { Token::SubClass::True,             "true"           },
+   { Token::SubClass::Type,             "type"           },
+   { Token::SubClass::Unit,             "unit"           },
+   { Token::SubClass::Until,            "until"          },
+   { Token::SubClass::Uses,             "uses"           },
+   { Token::SubClass::Var,              "var"            },
+   { Token::SubClass::While,            "while"          },
+   { Token::SubClass::With,             "with"           },
+   { Token::SubClass::IntConst,         "int const"      },
+   { Token::SubClass::FloatConst,       "float const"    },
+   { Token::SubClass::Identifier,       "identifier"     },
+   { Token::SubClass::StringLiteral,    "string literal" },
+   { Token::SubClass::EndOfFile,        "end of file"    },
+};
+
+LexicalAnalyzer::LexicalAnalyzer(const char* filename) : _cursor(nullptr), _currentState(FiniteAutomata::States::Whitespace), _skipRuns(true),
+                                                         _consumed(0), _lexed(0), _mark(NoMark), _scannedToEnd(false), _base(nullptr), _limit(nullptr), _end(nullptr),
+                                                         _window(false), _windowDone(false), _errorOffset(0), _errorState(FiniteAutomata::States::Amount),
+                                                         _commentEnds(nullptr), _prelexedAt(0) {
+    open(filename);
+};
+
+LexicalAnalyzer::LexicalAnalyzer(const char* base, const char* from, const char* limit, const char* end, FiniteAutomata::States start) :
+    _cursor(from), _currentState(start), _skipRuns(true), _consumed(0), _lexed(0), _mark(NoMark), _scannedToEnd(false),
+    _base(base), _limit(limit), _end(end), _window(true), _windowDone(false), _errorOffset(0), _errorState(FiniteAutomata::States::Amount),
+    _commentEnds(nullptr), _prelexedAt(0) {};
+
+const Token& LexicalAnalyzer::currentToken() const {
+    return _consumed ? _ring[(_consumed - 1) % RingSize] : _noToken;
+};
+
+// Scans up to RefillBatch tokens ahead. A lexical error ends the stream like EOF does,
+// it is kept and rethrown by peek() once the parser gets to it.
+void LexicalAnalyzer::refill() {
+    size_t oldest = _consumed ? _consumed - 1 : 0;
+    // a mark taken before the first advance() rewinds to before slot 0, which has to stay too
+    size_t marked = _mark ? _mark - 1 : 0;
+    if (_mark != NoMark && marked < oldest)
+        oldest = marked;
+    for (size_t i = 0; i < RefillBatch && !_scannedToEnd && _lexed - oldest < RingSize; ++i) {
+        if (_stream) {
+            // read from a token file, which also knows the error it ended with
+            if (!_stream->next(_ring[_lexed % RingSize])) {
+                _error = _stream->error();
+                _scannedToEnd = true;
+                break;
+            };
+        }
+        else if (!_prelexed.empty()) {
+            // ParallelLexer did the scanning up front, its error (if any) is already in _error
+            if (_prelexedAt == _prelexed.size()) {
+                _scannedToEnd = true;
+                break;
+            };
+            _ring[_lexed % RingSize] = _prelexed[_prelexedAt++];
+        }
+        else try {
+            _ring[_lexed % RingSize] = scan();
+        }
+        catch (...) {
+            _error = std::current_exception();
+            _scannedToEnd = true;
+            break;
+        };
+        _scannedToEnd = _ring[_lexed % RingSize]._subClass == Token::SubClass::EndOfFile;
+        ++_lexed;
+    };
+};
+
+const Token& LexicalAnalyzer::peek(size_t k) {
+    if (!_consumed && !k)
+        return _noToken;
+    size_t index = _consumed + k - 1;
+    while (index >= _lexed && !_scannedToEnd) {
+        size_t lexed = _lexed;
+        refill();
+        if (lexed == _lexed && !_scannedToEnd)
+            throw std::exception("Lookahead doesn't fit in the token ring");
+    };
+    if (index >= _lexed) {
+        if (_error)
+            std::rethrow_exception(_error);
+        index = _lexed - 1;
+    };
+    return _ring[index % RingSize];
+};
+
+const Token& LexicalAnalyzer::advance() {
+    const Token& t = peek(1);
+    if (_consumed < _lexed)
+        ++_consumed;
+    return t;
+};
+
+void LexicalAnalyzer::mark() {
+    _mark = _consumed;
+};
+
+void LexicalAnalyzer::rewind() {
+    if (_mark != NoMark)
+        _consumed = _mark;
+    _mark = NoMark;
+};
+
+void LexicalAnalyzer::release() {
+    _mark = NoMark;
+};
+
+char LexicalAnalyzer::read(const char*& at) {
+    at = _cursor;
+    char c = *_cursor++;
+    // the old text-mode stream folded CRLF into '\n', so it is one line break (LineIndex agrees)
+    if (c == '\r' && _cursor != _limit && *_cursor == '\n')
+        c = *_cursor++;
+    return c;
+};
+
+Token LexicalAnalyzer::scan() {
+    char c;
+    const char* at;
+    const char* begin = nullptr;
+    const char* end;
+    std::string val;
+    const char* code = nullptr;
+    FiniteAutomata::States state, exit;
+    while (_cursor != _limit || _currentState != FiniteAutomata::States::EndOfFile) {
+        if (_cursor == _limit && _limit != _end) {
+            // end of a ParallelLexer window, always right after a line break
+            _windowDone = true;
+            return _noToken;
+        };
+        if (_skipRuns) {
+            // whitespace, comment, string and identifier runs don't touch the token state, jump over them
+            const char* run = SimdScanner::skipRun(_currentState, _cursor, _limit);
+            if (_currentState == FiniteAutomata::States::String)
+                val.append(_cursor, run);
+            _cursor = run;
+        };
+        if (_engine == Engine::Direct) {
+            // the quiet steps run in DirectScanner's code, the one that stops it is taken below
+            const char* from = _cursor;
+            _currentState = DirectScanner::run(_currentState, _cursor, _limit, exit);
+            if (_cursor == _limit && _cursor != from)
+                continue;
+        };
+        if (_cursor == _limit) {
+            at = _cursor;
+            c = 0;
+            state = FiniteAutomata::atEnd(_currentState);
+        }
+        else {
+            c = read(at);
+            state = _engine == Engine::Direct ? exit : FiniteAutomata::next(_currentState, c);
+            // the slow path, strings and comments take a whole UTF-8 sequence at once
+            if ((c & 0x80) && state != FiniteAutomata::States::IllegalSymbol) {
+                const char* next = utf8Sequence(at, _limit);
+                if (!next)
+                    throwException(at, FiniteAutomata::States::IllegalSymbol);
+                _cursor = next;
+            };
+        };
+        switch (state) {
+        case FiniteAutomata::States::NewLine: 
+        case FiniteAutomata::States::CommentNewLine:
+            break;
+        case FiniteAutomata::States::BeginComment:
+        case FiniteAutomata::States::BeginMultilineComment:
+            begin = nullptr;
+            val = "";
+        case FiniteAutomata::States::Whitespace:
+            if (_commentEnds && (_currentState == FiniteAutomata::States::MultilineComment ||
+                                 _currentState == FiniteAutomata::States::Asterisk))
+                _commentEnds->push_back(static_cast<uint32_t>(_cursor - _base));
+        case FiniteAutomata::States::Comment:
+        case FiniteAutomata::States::MultilineComment:
+        case FiniteAutomata::States::Asterisk:
+            break;
+        case FiniteAutomata::States::ControlString:
+        case FiniteAutomata::States::StringStart:
+            if (code) {
+                val += codeToChar(_currentState, code, at);
+                code = nullptr;
+            }
+            if (!begin)
+                begin = at;
+            break;
+        case FiniteAutomata::States::String:
+            val.append(at, _cursor);
+        case FiniteAutomata::States::StringEnd:
+        case FiniteAutomata::States::Percent:
+        case FiniteAutomata::States::Dollar:
+        case FiniteAutomata::States::Ampersand:
+        case FiniteAutomata::States::Identifier:
+        case FiniteAutomata::States::OperatorDot:
+        case FiniteAutomata::States::OperatorCompare:
+        case FiniteAutomata::States::OperatorMult:
+        case FiniteAutomata::States::OperatorAssign:
+        case FiniteAutomata::States::Operator:
+        case FiniteAutomata::States::Decimal:
+        case FiniteAutomata::States::Bin:
+        case FiniteAutomata::States::Oct:
+        case FiniteAutomata::States::Hex:
+        case FiniteAutomata::States::Float:
+        case FiniteAutomata::States::FloatingPoint:
+        case FiniteAutomata::States::FloatExp:
+        case FiniteAutomata::States::FloatExpSign:
+        case FiniteAutomata::States::FloatEnd:
+        case FiniteAutomata::States::LeftParenthesis:
+        case FiniteAutomata::States::Slash:
+            if (!begin)
+                begin = at;
+            break;
+        case FiniteAutomata::States::DecimalCharCode:
+        case FiniteAutomata::States::BinCharCode:
+        case FiniteAutomata::States::OctCharCode:
+        case FiniteAutomata::States::HexCharCode:
+            if (c > '&' && !code)
+                code = at;
+            if (!begin)
+                begin = at;
+            break;
+        case FiniteAutomata::States::LookBack:
+            // "1..": give back the second dot too, the first one starts the subrange operator
+            state = FiniteAutomata::States::TokenEnd;
+            _currentState = FiniteAutomata::States::Decimal;
+            _cursor = end = at - 1;
+            goto token;
+        case FiniteAutomata::States::TokenEnd:
+            if (code) {
+                val += codeToChar(_currentState, code, at);
+                code = nullptr;
+            }
+            _cursor = end = at;
+            goto token;
+        case FiniteAutomata::States::EndOfFile:
+            _currentState = state = FiniteAutomata::States::EndOfFile;
+            begin = _eofText;
+            end = begin + 3;
+            goto token;
+        default:
+            throwException(at, state);
+            break;
+        }
+        _currentState = state;
+    }
+    return _noToken;
+
+    token:
+    const char* from = state == FiniteAutomata::States::EndOfFile ? _end : begin;
+    if (!Token::isInRange(_currentState, std::string_view(begin, end - begin)))
+        throwException(from, FiniteAutomata::States::ConstantOutOfRange);
+    Token t(_currentState, static_cast<uint32_t>(from - _base),
+            std::string_view(begin, end - begin), val.empty() ? std::string_view("", 0) : _arena.store(val));
+    _currentState = state;
+    return t;
+};
+
+// Past the well-formed UTF-8 sequence at at, nullptr for a stray continuation byte, an
+// overlong form, a surrogate, a code point past U+10FFFF or a sequence cut off by limit
+const char* LexicalAnalyzer::utf8Sequence(const char* at, const char* limit) {
+    unsigned char lead = static_cast<unsigned char>(*at);
+    size_t length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+    if (lead < 0xC2 || lead > 0xF4 || static_cast<size_t>(limit - at) < length)
+        return nullptr;
+    // only the second byte's range depends on the lead byte
+    unsigned char second = static_cast<unsigned char>(at[1]);
+    if (second < (lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80) ||
+        second > (lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF))
+        return nullptr;
+    for (size_t i = 2; i < length; ++i)
+        if ((static_cast<unsigned char>(at[i]) & 0xC0) != 0x80)
+            return nullptr;
+    return at + length;
+};
+
+char LexicalAnalyzer::codeToChar(FiniteAutomata::States state, const char* from, const char* to) {
+    unsigned int base = 10;
+    switch (state) {
+    case FiniteAutomata::States::BinCharCode:
+        base = 2;
+        break;
+    case FiniteAutomata::States::HexCharCode:
+        base = 16;
+        break;
+    case FiniteAutomata::States::OctCharCode:
+        base = 8;
+        break;
+    default:
+        break;
+    }
+    // codes past 255 wrap like they always did, only ones that don't even fit an int are an error
+    unsigned int code = 0;
+    if (std::from_chars(from, to, code, base).ec == std::errc::result_out_of_range)
+        throwException(to, FiniteAutomata::States::ConstantOutOfRange);
+    return static_cast<char>(code);
+};
+
+void LexicalAnalyzer::log(std::ostream &os) {
+    // an error replaces the whole dump, so nothing is written before lexing is done
+    std::vector<Token> tokens;
+    try {
+        while (!eof())
+            tokens.push_back(nextToken());
+    } catch (std::exception e) {
+        os << e.what();
+        return;
+    };
+    LogWriter out(os);
+    Token::Chars_t scratch;
+    size_t line = 0;
+    for (const Token& t : tokens) {
+        Token::Position_t pos = lines().position(t._offset, line);
+        out.position(pos.first, pos.second, 20);
+        out.column(_classDict.at(t._class), 20);
+        out.column(raw(t), 30);
+        out.write(t.text(scratch));
+        out.write('\n');
+    }
+};
+
+std::string_view LexicalAnalyzer::raw(const Token& t) const {
+    if (t._subClass == Token::SubClass::EndOfFile)
+        return _eofText;
+    return std::string_view(_base + t._offset, t._length);
+};
+
+template<typename T>
+void LexicalAnalyzer::open(T filename) {
+    _arena.clear();
+    _consumed = _lexed = 0;
+    _mark = NoMark;
+    _scannedToEnd = false;
+    _error = nullptr;
+    _prelexed.clear();
+    _prelexedAt = 0;
+    _stream = nullptr;
+    _lines.clear();
+    _source.open(filename);
+    _cursor = _base = _source.begin();
+    _limit = _end = _source.end();
+    _currentState = FiniteAutomata::States::Whitespace;
+    if (TokenStream::isTokenFile(_source)) {
+        try {
+            _stream = std::make_unique<TokenStream>(_source);
+        }
+        catch (...) {
+            // reported where a lexical error would be
+            _error = std::current_exception();
+            _scannedToEnd = true;
+            return;
+        };
+        _cursor = _base = _stream->source();
+        _limit = _end = _base + _stream->sourceSize();
+        return;
+    };
+    ParallelLexer::lex(*this, _threads);
+};
+template void LexicalAnalyzer::open<const char*>(const char*);
+template void LexicalAnalyzer::open<const std::string&>(const std::string&);
+
+bool LexicalAnalyzer::eof() {
+    return _consumed && currentToken()._subClass == Token::SubClass::EndOfFile;
+};
+const LineIndex& LexicalAnalyzer::lines() {
+    if (!_lines.built())
+        _lines.build(_base, _end);
+    return _lines;
+};
+
+Token::Position_t LexicalAnalyzer::position(size_t offset) {
+    return lines().position(offset);
+};
+
+// A window that runs to the end of the buffer never stops early; unlike one of
+// ParallelLexer's it reports its own errors
+std::shared_ptr<LexicalAnalyzer> LexicalAnalyzer::resume(size_t offset) const {
+    std::shared_ptr<LexicalAnalyzer> result(new LexicalAnalyzer(_base, _base + offset, _end, _end, FiniteAutomata::States::Whitespace));
+    result->_window = false;
+    return result;
+};
+
+void LexicalAnalyzer::throwException(const char* at, FiniteAutomata::States state) {
+    _errorOffset = at - _base;
+    _errorState = state;
+    // a window doesn't index the whole buffer for a message its owner would replace anyway
+    throw std::exception(_window ? "" : errorMessage(position(_errorOffset), state).c_str());
+};
+
+std::string LexicalAnalyzer::errorMessage(Token::Position_t pos, FiniteAutomata::States state) {
+    std::stringstream ss;
+    ss << "(" << pos.first << ", " << pos.second << "): ";
+    switch (state) {
+    case FiniteAutomata::States::EOLnWhileReading:
+        ss << "Unexpected end of line";
+        break;
+    case FiniteAutomata::States::IllegalSymbol:
+        ss << "Illegal symbol";
+        break;
+    case FiniteAutomata::States::NumberExpected:
+        ss << "Number expected";
+        break;
+    case FiniteAutomata::States::ScaleFactorExpected:
+        ss << "Exponent scale factor expected";
+        break;
+    case FiniteAutomata::States::UnexpectedEndOfFile:
+        ss << "Unexpected end of file";
+        break;
+    case FiniteAutomata::States::UnexpectedSymbol:
+        ss << "Unexpected symbol";
+        break;
+    case FiniteAutomata::States::ConstantOutOfRange:
+        ss << "Constant out of range";
+        break;
+    default:
+        return "What a Terrible Failure";
+    }
+    return ss.str();
 };
\ No newline at end of file
@@ -1,40 +1,123 @@
-#pragma once
-#include "FiniteAutomata.hpp"
-#include "Token.hpp"
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include <list>
-#include <iomanip>
-
-class LexicalAnalyzer {
-
-    typedef std::map<Token::Class, std::string> ClassDict_t;
-    typedef std::map<Token::SubClass, std::string> SubClassDict_t;
-
-    public:
-        LexicalAnalyzer() : _currentState(FiniteAutomata::States::Whitespace), _row(1), _column(1) {};
-        LexicalAnalyzer(const char* filename);
-        ~LexicalAnalyzer() {};
-
-        Token currentToken() const;
-        Token nextToken();
-        
-        template<typename T>
-        void open(T filename);
-        void log(std::ostream &os);
-        bool eof();
-
-    private:
-        void throwException(Token::Position_t pos, FiniteAutomata::States state);
-        char codeToChar(FiniteAutomata::States state, std::string code);
-
-        int _row;
-        int _column;
-        std::ifstream _file;
-        Token _currentToken;
-        FiniteAutomata::States _currentState;
-        static const ClassDict_t _classDict;
-        static const SubClassDict_t _subClassDict;
-        friend class Parser;
+#pragma once
+#include "FiniteAutomata.hpp"
+#include "Token.hpp"
+#include "SourceBuffer.hpp"
+#include "Arena.hpp"
+#include "SimdScanner.hpp"
+#include "DirectScanner.hpp"
+#include "LogWriter.hpp"
+#include "TokenStream.hpp"
+#include "LineIndex.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <list>
+#include <iomanip>
+#include <charconv>
+#include <exception>
+#include <vector>
+#include <memory>
+
+class LexicalAnalyzer {
+
+    typedef std::map<Token::Class, std::string> ClassDict_t;
+    typedef std::map<Token::SubClass, std::string> SubClassDict_t;
+
+    public:
+        // How scan() walks the DFA. The default is Table unless built with LEXER_DIRECT_CODED.
+        enum class Engine {
+            Table,      // FiniteAutomata::next, two table lookups per character
+            Direct,     // DirectScanner::run, code generated from the same tables
+        };
+
+        LexicalAnalyzer() : _cursor(nullptr), _currentState(FiniteAutomata::States::Whitespace), _skipRuns(true),
+                            _consumed(0), _lexed(0), _mark(NoMark), _scannedToEnd(false), _base(nullptr), _limit(nullptr), _end(nullptr),
+                            _window(false), _windowDone(false), _errorOffset(0), _errorState(FiniteAutomata::States::Amount),
+                            _commentEnds(nullptr), _prelexedAt(0) {};
+        LexicalAnalyzer(const char* filename);
+        ~LexicalAnalyzer() {};
+
+        // Tokens live in a fixed ring filled RefillBatch at a time. References stay valid until
+        // the ring wraps, i.e. for at least RingSize - RefillBatch further tokens.
+        static const size_t RingSize = 256;
+        static const size_t RefillBatch = 64;
+
+        const Token& currentToken() const;
+        const Token& nextToken() { return advance(); };
+        const Token& advance();
+        // k tokens past the current one, peek(0) is the current token. Past the end of file
+        // every peek is the EOF token; a lexical error is thrown when its position is reached.
+        const Token& peek(size_t k);
+        // One outstanding mark: rewind() goes back to the token current at mark(), release()
+        // forgets it. The ring doesn't overwrite a marked token, so keep the span short.
+        void mark();
+        void rewind();
+        void release();
+        
+        template<typename T>
+        void open(T filename);
+        void log(std::ostream &os);
+        bool eof();
+        // Row and column of a token of this lexer, counted from the line index built on first use
+        Token::Position_t position(const Token& t) { return position(t._offset); };
+        Token::Position_t position(size_t offset);
+        // A lexer over this one's source from offset on, which has to be where a token starts.
+        // It reads the same buffer, so this lexer has to outlive it.
+        std::shared_ptr<LexicalAnalyzer> resume(size_t offset) const;
+        // Lexers opened afterwards split large files between this many threads
+        static void setThreads(unsigned threads) { _threads = threads; };
+        static void setEngine(Engine engine) { _engine = engine; };
+        static Engine engine() { return _engine; };
+
+    private:
+        // A lexer over the window [from, limit) of a buffer that really ends at end,
+        // used by ParallelLexer. It stops after the last line break of the window. Its errors
+        // leave the message to the owner of the whole buffer, see _errorOffset.
+        LexicalAnalyzer(const char* base, const char* from, const char* limit, const char* end, FiniteAutomata::States start);
+
+        void throwException(const char* at, FiniteAutomata::States state);
+        static std::string errorMessage(Token::Position_t pos, FiniteAutomata::States state);
+        char codeToChar(FiniteAutomata::States state, const char* from, const char* to);
+        char read(const char*& at);
+        static const char* utf8Sequence(const char* at, const char* limit);
+        std::string_view raw(const Token& t) const;
+        const LineIndex& lines();
+        Token scan();
+        void refill();
+
+        SourceBuffer _source;
+        Arena _arena;
+        const char* _cursor;
+        FiniteAutomata::States _currentState;
+        bool _skipRuns;
+        Token _ring[RingSize];
+        size_t _consumed;
+        size_t _lexed;
+        size_t _mark;
+        bool _scannedToEnd;
+        std::exception_ptr _error;
+        const char* _base;
+        const char* _limit;
+        const char* _end;
+        bool _window;
+        bool _windowDone;
+        LineIndex _lines;
+        size_t _errorOffset;
+        FiniteAutomata::States _errorState;
+        std::vector<uint32_t>* _commentEnds;
+        std::vector<Token> _prelexed;
+        size_t _prelexedAt;
+        std::unique_ptr<TokenStream> _stream;
+        static unsigned _threads;
+        static Engine _engine;
+        static const size_t NoMark = static_cast<size_t>(-1);
+        static const Token _noToken;
+        static const char _eofText[];
+        static const ClassDict_t _classDict;
+        static const SubClassDict_t _subClassDict;
+        friend class Parser;
+        friend class Benchmark;
+        friend class ParallelLexer;
+        friend class IncrementalLexer;
+        friend class TokenStream;
 };
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "LineIndex.hpp"
+#include "SimdScanner.hpp"
+#include <algorithm>
+
+void LineIndex::build(const char* begin, const char* end) {
+    _starts.assign(1, 0);
+    for (const char* at = begin; (at = SimdScanner::lineBreak(at, end)) != end;) {
+        if (*at++ == '\r' && at != end && *at == '\n')
+            ++at;
+        _starts.push_back(static_cast<uint32_t>(at - begin));
+    };
+};
+
+Token::Position_t LineIndex::position(size_t offset) const {
+    size_t line = std::upper_bound(_starts.begin(), _starts.end(), offset) - _starts.begin() - 1;
+    return { static_cast<int>(line + 1), static_cast<int>(offset - _starts[line] + 1) };
+};
+
+Token::Position_t LineIndex::position(size_t offset, size_t& line) const {
+    if (line >= _starts.size() || _starts[line] > offset)
+        return position(offset);
+    while (line + 1 < _starts.size() && _starts[line + 1] <= offset)
+        ++line;
+    return { static_cast<int>(line + 1), static_cast<int>(offset - _starts[line] + 1) };
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include "Token.hpp"
+#include <cstdint>
+#include <vector>
+
+// Start offsets of the lines of a buffer. Tokens and errors only carry byte offsets, this
+// turns one into (row, column) when a message or the log needs it. Line breaks are the
+// ones the lexer's DFA sees: "\n", "\r" and "\r\n" taken once, columns count bytes.
+class LineIndex {
+    public:
+        void build(const char* begin, const char* end);
+        void clear() { _starts.clear(); };
+        bool built() const { return !_starts.empty(); };
+        Token::Position_t position(size_t offset) const;
+        // For ascending offsets, e.g. a token dump: walks on from the line of the last lookup
+        Token::Position_t position(size_t offset, size_t& line) const;
+
+    private:
+        std::vector<uint32_t> _starts;
+};
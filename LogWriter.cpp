@@ -0,0 +1,56 @@
+#include "LogWriter.hpp"
+#include <charconv>
+#include <cstring>
+
+void LogWriter::write(std::string_view s) {
+    if (_used + s.length() > BufferSize) {
+        flush();
+        // nothing to gain from copying what fills the buffer by itself
+        if (s.length() >= BufferSize) {
+            _os.write(s.data(), s.length());
+            return;
+        };
+    };
+    memcpy(_buffer.get() + _used, s.data(), s.length());
+    _used += s.length();
+};
+
+void LogWriter::write(char c) {
+    if (_used == BufferSize)
+        flush();
+    _buffer[_used++] = c;
+};
+
+void LogWriter::spaces(size_t count) {
+    while (count) {
+        if (_used == BufferSize)
+            flush();
+        size_t n = count < BufferSize - _used ? count : BufferSize - _used;
+        memset(_buffer.get() + _used, ' ', n);
+        _used += n;
+        count -= n;
+    };
+};
+
+void LogWriter::column(std::string_view s, size_t width) {
+    write(s);
+    spaces(s.length() > width ? s.length() - width : width - s.length());
+};
+
+void LogWriter::position(unsigned long long row, unsigned long long column, size_t width) {
+    char text[48];
+    char* at = text;
+    *at++ = '(';
+    at = std::to_chars(at, text + sizeof(text), row).ptr;
+    *at++ = ',';
+    *at++ = ' ';
+    at = std::to_chars(at, text + sizeof(text), column).ptr;
+    *at++ = ')';
+    this->column(std::string_view(text, at - text), width);
+};
+
+void LogWriter::flush() {
+    if (_used)
+        _os.write(_buffer.get(), _used);
+    _used = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <ostream>
+#include <string_view>
+#include <memory>
+
+// Output buffer for the -l dump: text is copied into one reusable block that is handed
+// to the stream with a single write whenever it fills up, and once more on flush().
+class LogWriter {
+    public:
+        LogWriter(std::ostream& os) : _os(os), _buffer(new char[BufferSize]), _used(0) {};
+        LogWriter(const LogWriter&) = delete;
+        LogWriter& operator=(const LogWriter&) = delete;
+        ~LogWriter() { flush(); };
+
+        void write(std::string_view s);
+        void write(char c);
+        void spaces(size_t count);
+        // s followed by |width - length| spaces, the padding the log has always used
+        void column(std::string_view s, size_t width);
+        // "(row, col)" padded to width
+        void position(unsigned long long row, unsigned long long column, size_t width);
+        void flush();
+
+    private:
+        static const size_t BufferSize = 64 * 1024;
+
+        std::ostream& _os;
+        std::unique_ptr<char[]> _buffer;
+        size_t _used;
+};
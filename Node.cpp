@@ -1,127 +1,145 @@
-#include "Node.hpp"
-
-void Node::addChild(PNode_t pnode) {
-    _children.push_back(pnode);
-};
-
-std::string Node::toString() {
-    return _token.toString();
-};
-
-void Node::generate() {
-
-};
-
-NamedNode::NamedNode(Type type, std::string name) : 
-    Node(type), _name(name) {};
-AtomicNode::AtomicNode(Type type, Token token) : 
-    Node(type, token) {};
-
-IntConst::IntConst(Token t) : 
-    AtomicNode(Type::IntConst, t) {};
-FloatConst::FloatConst(Token t) : 
-    AtomicNode(Type::FloatConst, t) {};
-Identifier::Identifier(Token t) : 
-    AtomicNode(Type::Identifier, t), isAssignment(false) {};
-CharConst::CharConst(Token t) : 
-    AtomicNode(Type::CharConst, t) {};
-StringLiteral::StringLiteral(Token t) : 
-    AtomicNode(Type::StringLiteral, t) {};
-TypeAlias::TypeAlias(Token t) : 
-    AtomicNode(Type::TypeAlias, t) {};
-
-ParentNode::ParentNode(Type type, Token token, Node::PNode_t child) : Node(type, token) {
-    addChild(child);
-};
-
-ParentNode::ParentNode(Type type, Token token, Node::PNode_t left, Node::PNode_t right) : Node(type, token) {
-    addChild(left);
-    addChild(right);
-};
-
-ParentNode::ParentNode(Type type, Token token, Node::VecPNode_t children) : Node(type, token) {
-    addChildren(children);
-}
-
-ParentNode::ParentNode(Type type, Node::VecPNode_t children) : Node(type) {
-    addChildren(children);
-};
-
-ParentNode::ParentNode(Type type, Node::PNode_t left, Node::VecPNode_t right) : Node(type) {
-    addChild(left);
-    addChildren(right);
-};
-
-void ParentNode::addChildren(Node::VecPNode_t children) {
-    for (auto i : children)
-        addChild(i);
-}
-
-DeclarationsBlock::DeclarationsBlock(Node::VecPNode_t declarations) : 
-    ParentNode(Type::DeclarationBlock, declarations), _name("declarations") {};
-StatementsBlock::StatementsBlock(Node::VecPNode_t statements) : 
-    ParentNode(Type::StatementBlock, statements), _name("statements") {};
-Declaration::Declaration(Type type, Token keyword, Node::VecPNode_t declarations) : 
-    ParentNode(type, keyword, declarations) {};
-Declaration::Declaration(Type type, Token keyword, Node::PNode_t declaration) : 
-    ParentNode(type, keyword, declaration) {};
-Record::Record(Token keyword, Node::VecPNode_t fields) : 
-    Declaration(Type::Record, keyword, fields) {};
-Record::Record(Token keyword, Node::VecPNode_t fields, Node::PSymTable_t symTable) : 
-    Declaration(Type::Record, keyword, fields), _localSymTable(symTable) {};
-
-Function::Function(Token name, Node::VecPNode_t children, Node::PNode_t params, Node::PNode_t type, Node::PVecPSymTable_t symTables) :
-    Declaration(Type::Function, name, children), _paramList(params), _type(type), _localSymTables(symTables) {};
-Procedure::Procedure(Token name, Node::VecPNode_t children, Node::PNode_t params, Node::PVecPSymTable_t symTables) : 
-    Declaration(Type::Procedure, name, children), _paramList(params), _type(nullptr), _localSymTables(symTables) {};
-
-UnaryOperator::UnaryOperator(Token op, Node::PNode_t expr) : 
-    ParentNode(Type::UnaryOperator, op, expr) {};
-BinaryOperator::BinaryOperator(Token op, PNode_t left, PNode_t right) : 
-    ParentNode(Type::BinaryOperator, op, left, right) {};
-Subrange::Subrange(Token op, Node::PNode_t lowerBound, Node::PNode_t upperBound) : 
-    ParentNode(Type::Subrange, op, lowerBound, upperBound) {
-    _lowerBound = lowerBound->_token._value.ull;
-    _upperBound = upperBound->_token._value.ull;
-};
-
-AccessNode::AccessNode(Node::Type type, Node::PNode_t child, std::string name) : 
-    ParentNode(type, Node::VecPNode_t{child}), _name(name) {};
-AccessNode::AccessNode(Node::Type type, Node::VecPNode_t args, std::string name) : 
-    ParentNode(type, args), _name(name) {};
-AccessNode::AccessNode(Node::Type type, Node::PNode_t caller, Node::PNode_t arg, std::string name) : 
-    ParentNode(type, Node::VecPNode_t{caller, arg}), _name(name) {};
-AccessNode::AccessNode(Node::Type type, Node::PNode_t caller, Node::VecPNode_t args, std::string name) : 
-    ParentNode(type, caller, args), _name(name) {};
-
-TypeNode::TypeNode(Node::PNode_t child, Node::Type type) : 
-    AccessNode(Type::Type, child, "type"), _type(type) {};
-TypeNode::TypeNode(Node::PNode_t child, Node::Type type, std::string name) :
-    AccessNode(Type::Type, child, name), _type(type) {};
-ValueNode::ValueNode(Node::VecPNode_t children) : 
-    AccessNode(Type::Value, children, "value") {};
-ValueNode::ValueNode(Node::VecPNode_t children, std::string name) : 
-    AccessNode(Type::Value, children, name) {};
-RecordAccess::RecordAccess(Node::PNode_t record, Node::PNode_t field) : 
-    AccessNode(Type::RecordAccess, record, field, ".") {};
-ArrayIndex::ArrayIndex(Node::PNode_t array, Node::PNode_t index) : 
-    AccessNode(Type::ArrayIndex, array, index, "[]") {};
-ParameterList::ParameterList(Node::VecPNode_t children) :
-    AccessNode(Type::ParameterList, children, "parameters"), _paramList(children) {};
-FunctionCall::FunctionCall(Node::PNode_t function, Node::VecPNode_t args) : 
-    AccessNode(Type::FunctionCall, function, args, "()") {};
-
-Write::Write(Token token, Node::PNode_t arg) : 
-    ParentNode(Node::Type::Write, token, arg), _argument(arg) {};
-WriteLn::WriteLn(Token token, Node::PNode_t arg) : 
-    ParentNode(Node::Type::WriteLn, token, arg), _argument(arg) {};
-If::If(Token token, PNode_t condition, PNode_t thenBranch, PNode_t elseBranch) : 
-    ParentNode(Node::Type::If, token, thenBranch, elseBranch), _condition(condition), _thenBranch(thenBranch), _elseBranch(elseBranch) {};
-For::For(Token token, PNode_t initial, PNode_t to_downto, PNode_t final, PNode_t body) :
-    ParentNode(Node::Type::For, token, body), _initial(initial), _to_downto(to_downto), _final(final) {};
-To::To(Token token) : 
-    AtomicNode(Node::Type::To, token) {};
-DownTo::DownTo(Token token) :
-    AtomicNode(Node::Type::DownTo, token) {};
-ReservedWord::ReservedWord(Token token) :
-    AtomicNode(Node::Type::ReservedWord, token) {};
\ No newline at end of file
+#include "Node.hpp"
+#include <cstring>
+
+void Node::addChild(Arena& arena, PNode_t pnode) {
+    if (_children._size == _children._capacity)
+        reserve(arena, _children._capacity ? 2 * _children._capacity : 2);
+    _children._data[_children._size++] = pnode;
+};
+
+void Node::reserve(Arena& arena, size_t capacity) {
+    if (capacity <= _children._capacity)
+        return;
+    // the old array stays behind in the arena, growth is rare after construction
+    PNode_t* data = arena.array<PNode_t>(capacity);
+    if (_children._size)
+        memcpy(data, _children._data, _children._size * sizeof(PNode_t));
+    _children._data = data;
+    _children._capacity = static_cast<uint32_t>(capacity);
+};
+
+std::string Node::toString() {
+    if (const char* text = name())
+        return text;
+    return _token.toString();
+};
+
+void Node::generate() {
+
+};
+
+NamedNode::NamedNode(Type type, const char* name) : 
+    Node(type), _name(name) {};
+AtomicNode::AtomicNode(Type type, Token token) : 
+    Node(type, token) {};
+
+IntConst::IntConst(Token t) : 
+    AtomicNode(Type::IntConst, t) {};
+FloatConst::FloatConst(Token t) : 
+    AtomicNode(Type::FloatConst, t) {};
+Identifier::Identifier(Token t) : 
+    AtomicNode(Type::Identifier, t), isAssignment(false), _binding(SymbolTable::NoBinding) {};
+CharConst::CharConst(Token t) : 
+    AtomicNode(Type::CharConst, t) {};
+StringLiteral::StringLiteral(Token t) : 
+    AtomicNode(Type::StringLiteral, t) {};
+TypeAlias::TypeAlias(Token t) : 
+    AtomicNode(Type::TypeAlias, t) {};
+
+ParentNode::ParentNode(Arena& arena, Type type, Token token, Node::PNode_t child) : Node(type, token) {
+    reserve(arena, 1);
+    addChild(arena, child);
+};
+
+ParentNode::ParentNode(Arena& arena, Type type, Token token, Node::PNode_t left, Node::PNode_t right) : Node(type, token) {
+    reserve(arena, 2);
+    addChild(arena, left);
+    addChild(arena, right);
+};
+
+ParentNode::ParentNode(Arena& arena, Type type, Token token, const Node::VecPNode_t& children) : Node(type, token) {
+    addChildren(arena, children);
+}
+
+ParentNode::ParentNode(Arena& arena, Type type, const Node::VecPNode_t& children) : Node(type) {
+    addChildren(arena, children);
+};
+
+ParentNode::ParentNode(Arena& arena, Type type, Node::PNode_t left, const Node::VecPNode_t& right) : Node(type) {
+    reserve(arena, 1 + right.size());
+    addChild(arena, left);
+    addChildren(arena, right);
+};
+
+void ParentNode::addChildren(Arena& arena, const Node::VecPNode_t& children) {
+    reserve(arena, _children.size() + children.size());
+    for (auto i : children)
+        addChild(arena, i);
+}
+
+DeclarationsBlock::DeclarationsBlock(Arena& arena, const Node::VecPNode_t& declarations) : 
+    ParentNode(arena, Type::DeclarationBlock, declarations), _name("declarations") {};
+StatementsBlock::StatementsBlock(Arena& arena, const Node::VecPNode_t& statements) : 
+    ParentNode(arena, Type::StatementBlock, statements), _name("statements") {};
+Declaration::Declaration(Arena& arena, Type type, Token keyword, const Node::VecPNode_t& declarations) : 
+    ParentNode(arena, type, keyword, declarations) {};
+Declaration::Declaration(Arena& arena, Type type, Token keyword, Node::PNode_t declaration) : 
+    ParentNode(arena, type, keyword, declaration) {};
+Record::Record(Arena& arena, Token keyword, const Node::VecPNode_t& fields) : 
+    Declaration(arena, Type::Record, keyword, fields) {};
+
+Function::Function(Arena& arena, Token name, const Node::VecPNode_t& children, Node::PNode_t params, Node::PNode_t type) :
+    Declaration(arena, Type::Function, name, children), _paramList(params), _type(type) {};
+Procedure::Procedure(Arena& arena, Token name, const Node::VecPNode_t& children, Node::PNode_t params) : 
+    Declaration(arena, Type::Procedure, name, children), _paramList(params), _type(nullptr) {};
+
+UnaryOperator::UnaryOperator(Arena& arena, Token op, Node::PNode_t expr) : 
+    ParentNode(arena, Type::UnaryOperator, op, expr) {};
+BinaryOperator::BinaryOperator(Arena& arena, Token op, PNode_t left, PNode_t right) : 
+    ParentNode(arena, Type::BinaryOperator, op, left, right) {};
+Subrange::Subrange(Arena& arena, Token op, Node::PNode_t lowerBound, Node::PNode_t upperBound) : 
+    ParentNode(arena, Type::Subrange, op, lowerBound, upperBound) {
+    _lowerBound = lowerBound->_token.intValue();
+    _upperBound = upperBound->_token.intValue();
+};
+
+AccessNode::AccessNode(Arena& arena, Node::Type type, Node::PNode_t child, const char* name) : 
+    ParentNode(arena, type, Token(), child), _name(name) {};
+AccessNode::AccessNode(Arena& arena, Node::Type type, const Node::VecPNode_t& args, const char* name) : 
+    ParentNode(arena, type, args), _name(name) {};
+AccessNode::AccessNode(Arena& arena, Node::Type type, Node::PNode_t caller, Node::PNode_t arg, const char* name) : 
+    ParentNode(arena, type, Token(), caller, arg), _name(name) {};
+AccessNode::AccessNode(Arena& arena, Node::Type type, Node::PNode_t caller, const Node::VecPNode_t& args, const char* name) : 
+    ParentNode(arena, type, caller, args), _name(name) {};
+
+TypeNode::TypeNode(Arena& arena, Node::PNode_t child, Node::Type type) : 
+    AccessNode(arena, Type::Type, child, "type"), _type(type) {};
+TypeNode::TypeNode(Arena& arena, Node::PNode_t child, Node::Type type, const char* name) :
+    AccessNode(arena, Type::Type, child, name), _type(type) {};
+ValueNode::ValueNode(Arena& arena, const Node::VecPNode_t& children) : 
+    AccessNode(arena, Type::Value, children, "value") {};
+ValueNode::ValueNode(Arena& arena, const Node::VecPNode_t& children, const char* name) : 
+    AccessNode(arena, Type::Value, children, name) {};
+RecordAccess::RecordAccess(Arena& arena, Node::PNode_t record, Node::PNode_t field) : 
+    AccessNode(arena, Type::RecordAccess, record, field, ".") {};
+ArrayIndex::ArrayIndex(Arena& arena, Node::PNode_t array, Node::PNode_t index) : 
+    AccessNode(arena, Type::ArrayIndex, array, index, "[]") {};
+ParameterList::ParameterList(Arena& arena, const Node::VecPNode_t& children) :
+    AccessNode(arena, Type::ParameterList, children, "parameters") {};
+FunctionCall::FunctionCall(Arena& arena, Node::PNode_t function, const Node::VecPNode_t& args) : 
+    AccessNode(arena, Type::FunctionCall, function, args, "()") {};
+
+Write::Write(Arena& arena, Token token, Node::PNode_t arg) : 
+    ParentNode(arena, Node::Type::Write, token, arg), _argument(arg) {};
+WriteLn::WriteLn(Arena& arena, Token token, Node::PNode_t arg) : 
+    ParentNode(arena, Node::Type::WriteLn, token, arg), _argument(arg) {};
+If::If(Arena& arena, Token token, PNode_t condition, PNode_t thenBranch, PNode_t elseBranch) : 
+    ParentNode(arena, Node::Type::If, token, thenBranch, elseBranch), _condition(condition), _thenBranch(thenBranch), _elseBranch(elseBranch) {};
+For::For(Arena& arena, Token token, PNode_t initial, PNode_t to_downto, PNode_t final, PNode_t body) :
+    ParentNode(arena, Node::Type::For, token, body), _initial(initial), _to_downto(to_downto), _final(final) {};
+To::To(Token token) : 
+    AtomicNode(Node::Type::To, token) {};
+DownTo::DownTo(Token token) :
+    AtomicNode(Node::Type::DownTo, token) {};
+ReservedWord::ReservedWord(Token token) :
+    AtomicNode(Node::Type::ReservedWord, token) {};
@@ -0,0 +1,137 @@
+#include "ParallelLexer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+// Chunk boundaries sit right after a '\n', so "\r\n" is never split
+std::vector<const char*> ParallelLexer::split(const char* begin, const char* end, size_t count) {
+    std::vector<const char*> bounds = { begin };
+    size_t size = end - begin;
+    for (size_t i = 1; i < count; ++i) {
+        const char* target = begin + size / count * i;
+        if (target <= bounds.back())
+            continue;
+        const char* lineBreak = static_cast<const char*>(memchr(target, '\n', end - target));
+        if (!lineBreak || lineBreak + 1 == end)
+            break;
+        if (lineBreak + 1 > bounds.back())
+            bounds.push_back(lineBreak + 1);
+    };
+    bounds.push_back(end);
+    return bounds;
+};
+
+void ParallelLexer::speculate(LexicalAnalyzer& lexer, const Chunk_t& chunk, FiniteAutomata::States start, Speculation_t& result) {
+    LexicalAnalyzer window(lexer._base, chunk.from, chunk.to, lexer._end, start);
+    window._skipRuns = lexer._skipRuns;
+    if (start != FiniteAutomata::States::CommentNewLine)
+        window._commentEnds = &result.commentEnds;
+    result.converged = false;
+    try {
+        while (true) {
+            Token t = window.scan();
+            if (window._windowDone)
+                break;
+            result.tokens.push_back(t);
+            if (t._subClass == Token::SubClass::EndOfFile)
+                break;
+        };
+    }
+    catch (...) {
+        result.error = std::current_exception();
+        result.errorOffset = window._errorOffset;
+        result.errorState = window._errorState;
+    };
+    result.end = window._currentState;
+    result.arena.adopt(window._arena);
+};
+
+// Where a comment open at from closes, nullptr if it doesn't close cleanly before to
+const char* ParallelLexer::commentEnd(const char* from, const char* to) {
+    FiniteAutomata::States state = FiniteAutomata::States::CommentNewLine;
+    while (from != to) {
+        from = SimdScanner::skipRun(state, from, to);
+        if (from == to)
+            break;
+        const char* at = from;
+        state = FiniteAutomata::next(state, *from++);
+        // a malformed sequence is an error the real run has to report
+        if ((*at & 0x80) && !(from = LexicalAnalyzer::utf8Sequence(at, to)))
+            return nullptr;
+        if (state == FiniteAutomata::States::Whitespace)
+            return from;
+        if (state != FiniteAutomata::States::MultilineComment && state != FiniteAutomata::States::Asterisk &&
+            state != FiniteAutomata::States::CommentNewLine)
+            return nullptr;
+    };
+    return nullptr;
+};
+
+// Usually the chunk really starts in plain code and the first comment the plain run
+// meets closes where this run's comment does. From that point both runs are in the same
+// state at the same offset and row, so the plain run's tokens are reused as they are.
+void ParallelLexer::speculateComment(LexicalAnalyzer& lexer, Chunk_t& chunk) {
+    Speculation_t& result = chunk.comment;
+    const char* close = commentEnd(chunk.from, chunk.to);
+    if (close) {
+        uint32_t offset = static_cast<uint32_t>(close - lexer._base);
+        auto i = std::lower_bound(chunk.plain.commentEnds.begin(), chunk.plain.commentEnds.end(), offset);
+        if (i != chunk.plain.commentEnds.end() && *i == offset) {
+            result.converged = true;
+            result.convergedFrom = std::lower_bound(chunk.plain.tokens.begin(), chunk.plain.tokens.end(), offset,
+                [](const Token& t, uint32_t offset) { return t._offset < offset; }) - chunk.plain.tokens.begin();
+            return;
+        };
+    };
+    speculate(lexer, chunk, FiniteAutomata::States::CommentNewLine, result);
+};
+
+void ParallelLexer::lex(LexicalAnalyzer& lexer, unsigned threads) {
+    size_t size = lexer._end - lexer._base;
+    if (threads < 2 || size < 2 * MinChunkSize)
+        return;
+    std::vector<const char*> bounds = split(lexer._base, lexer._end, std::min<size_t>(threads * 4, size / MinChunkSize));
+    if (bounds.size() < 3)
+        return;
+
+    std::vector<Chunk_t> chunks(bounds.size() - 1);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        chunks[i].from = bounds[i];
+        chunks[i].to = bounds[i + 1];
+    };
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < std::min<size_t>(threads, chunks.size()); ++i)
+        workers.emplace_back([&]() {
+            for (size_t k; (k = next++) < chunks.size();) {
+                speculate(lexer, chunks[k], k ? FiniteAutomata::States::NewLine : FiniteAutomata::States::Whitespace, chunks[k].plain);
+                if (k)
+                    speculateComment(lexer, chunks[k]);
+            };
+        });
+    for (auto& i : workers)
+        i.join();
+
+    // stitch: each chunk starts in the state the previous one ended in
+    bool inComment = false;
+    for (auto& chunk : chunks) {
+        const Speculation_t* run = inComment ? &chunk.comment : &chunk.plain;
+        size_t first = 0;
+        if (inComment && chunk.comment.converged) {
+            run = &chunk.plain;
+            first = chunk.comment.convergedFrom;
+        };
+        lexer._prelexed.insert(lexer._prelexed.end(), run->tokens.begin() + first, run->tokens.end());
+        lexer._arena.adopt(chunk.plain.arena);
+        lexer._arena.adopt(chunk.comment.arena);
+        if (run->error) {
+            lexer._error = run->errorState == FiniteAutomata::States::Amount ? run->error :
+                std::make_exception_ptr(std::exception(LexicalAnalyzer::errorMessage(
+                    lexer.position(run->errorOffset), run->errorState).c_str()));
+            return;
+        };
+        inComment = run->end == FiniteAutomata::States::CommentNewLine;
+    };
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include "LexicalAnalyzer.hpp"
+#include <vector>
+
+// Splits a large buffer into line-aligned chunks and lexes them on several threads.
+// Right after a line break the DFA can only be in plain code (NewLine) or inside a
+// { } / (* *) comment (CommentNewLine, both comment kinds share it): strings and //
+// comments end at the line. Every chunk is therefore lexed speculatively for both start
+// states, and the chunks are stitched in order by following the end state of each one.
+// The result is the exact token stream and first error of the sequential lexer; tokens
+// only carry offsets, so nothing has to be renumbered across chunks.
+class ParallelLexer {
+
+    struct Speculation_t {
+        std::vector<Token> tokens;
+        std::vector<uint32_t> commentEnds;
+        FiniteAutomata::States end;
+        std::exception_ptr error;
+        size_t errorOffset;
+        FiniteAutomata::States errorState;
+        Arena arena;
+        // the comment run closed its comment where the plain run did: it continues with
+        // the plain run's tokens from this index on
+        bool converged;
+        size_t convergedFrom;
+    };
+
+    struct Chunk_t {
+        const char* from;
+        const char* to;
+        Speculation_t plain;
+        Speculation_t comment;
+    };
+
+    public:
+        static const size_t MinChunkSize = 256 * 1024;
+
+        // Fills lexer's pre-lexed token stream when the buffer is worth splitting
+        static void lex(LexicalAnalyzer& lexer, unsigned threads);
+
+    private:
+        static std::vector<const char*> split(const char* begin, const char* end, size_t count);
+        static void speculate(LexicalAnalyzer& lexer, const Chunk_t& chunk, FiniteAutomata::States start, Speculation_t& result);
+        static void speculateComment(LexicalAnalyzer& lexer, Chunk_t& chunk);
+        static const char* commentEnd(const char* from, const char* to);
+};
@@ -1,1018 +1,1216 @@
-﻿#include "Parser.hpp"
-
-
-
-const std::vector<std::set<Token::SubClass>> Parser::_precedences = {
-    {
-        Token::SubClass::Not,
-        Token::SubClass::Add,
-        Token::SubClass::Sub,
-        Token::SubClass::Address,
-        Token::SubClass::Exp,
-    },
-    {
-        Token::SubClass::Mult,
-        Token::SubClass::Div,
-        Token::SubClass::IntDiv,
-        Token::SubClass::Mod,
-        Token::SubClass::And,
-        Token::SubClass::SHL,
-        Token::SubClass::SHR,
-    },
-    {
-        Token::SubClass::Add,
-        Token::SubClass::Sub,
-        Token::SubClass::Or,
-        Token::SubClass::Xor,
-    },
-    {
-        Token::SubClass::Equal,
-        Token::SubClass::NEQ,
-        Token::SubClass::Less,
-        Token::SubClass::More,
-        Token::SubClass::LEQ, 
-        Token::SubClass::MEQ,
-        Token::SubClass::In,
-    },
-};
-
-const std::set<Node::Type> Parser::_reducibleScalarTypes = {
-    Node::Type::Integer,
-    Node::Type::Float,
-    Node::Type::Char,
-};
-
-const Parser::NodeTypesDict_t Parser::_nodeTypes = {
-    { Node::Type::Identifier,      "Identifier"      },
-    { Node::Type::ConstIdentifier, "ConstIdentifier" },
-    { Node::Type::Integer,         "Integer"         },
-    { Node::Type::Float,           "Real"            },
-    { Node::Type::Char,            "Char"            },
-    { Node::Type::Subrange,        "Subrange"        },
-    { Node::Type::String,          "String"          },
-    { Node::Type::Record,          "Record"          },
-    { Node::Type::Array,           "Array"           },
-    { Node::Type::IntConst,        "IntConst"        },
-    { Node::Type::FloatConst,      "FloatConst"      },
-    { Node::Type::CharConst,       "CharConst"       },
-    { Node::Type::StringLiteral,   "StringLiteral"   },
-};
-
-const Parser::SubClassTypeDict_t Parser::_subClassNodeTypes = {
-    { Token::SubClass::IntConst,   Node::Type::IntConst   },
-    { Token::SubClass::FloatConst, Node::Type::FloatConst },
-    { Token::SubClass::String,     Node::Type::String     },
-    { Token::SubClass::Array,      Node::Type::Array      },
-    { Token::SubClass::Record,     Node::Type::Record     },
-};
-
-const Parser::OrdinalInitializersDict_t Parser::_ordinalInitializers = {
-    { Node::Type::Integer,     Node::Type::IntConst      },
-    { Node::Type::IntConst,    Node::Type::IntConst      },
-    { Node::Type::Subrange,    Node::Type::IntConst      },
-    { Node::Type::Float,       Node::Type::FloatConst    },
-    { Node::Type::FloatConst,  Node::Type::FloatConst    },
-    { Node::Type::String,      Node::Type::StringLiteral },
-    { Node::Type::Char,        Node::Type::CharConst     },
-    { Node::Type::CharConst,   Node::Type::CharConst     },
-};
-
-const Parser::IdentifierTypeDict_t Parser::_identifierNodeTypes = {
-    { "integer", Node::Type::Integer },
-    { "char",    Node::Type::Char    },
-    { "real",    Node::Type::Float   },
-};
-
-const Parser::DeclarationsKeywordsSet_t Parser::_declKeywords = {
-    Token::SubClass::Var,
-    Token::SubClass::Type,
-    Token::SubClass::Const,
-    Token::SubClass::Procedure,
-    Token::SubClass::Function
-};
-
-Parser::Parser(const char* filename) {
-    open(filename);
-};
-
-Node::PNode_t Parser::parseProgram() {
-    _funcIdentifiersTable = std::make_shared<std::set<std::string>>();
-    _symTables = std::make_shared<VecPSymTable_t>();
-    _typeAliases = std::make_shared<Node::SymTable_t>();
-    Node::PNode_t program = parseProgramHeading();
-    if (_declKeywords.count(_lexicalAnalyzer->currentToken()._subClass))
-        program->addChild(parseDeclaration());
-    expect(Token::SubClass::Begin);
-    _lexicalAnalyzer->nextToken();
-    if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::End)
-        program->addChild(parseStatement());
-    expect(Token::SubClass::End);
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Dot);
-    return program;
-};
-
-Node::PNode_t Parser::parseProgramHeading() {
-    Node::PNode_t heading;
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Program);
-    heading = std::make_shared<Node>(Node::Type::Program, _lexicalAnalyzer->currentToken());
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
-    heading->addChild(std::make_shared<Identifier>(_lexicalAnalyzer->currentToken()));
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
-    _lexicalAnalyzer->nextToken();
-    return heading;
-};
-
-Node::PNode_t Parser::parseDeclaration() {
-    Node::VecPNode_t declarations;
-    while (true) {
-        Token t = _lexicalAnalyzer->currentToken();
-        _symTables->push_back(std::make_shared<Node::SymTable_t>());
-        switch (t._subClass) {
-        case Token::SubClass::Var:
-            _lexicalAnalyzer->nextToken();
-            declarations.push_back(parseVarDecl(t));
-            break;
-        case Token::SubClass::Type:
-            _lexicalAnalyzer->nextToken();
-            declarations.push_back(parseTypeDecl(t));
-            break;
-        case Token::SubClass::Const:
-            _lexicalAnalyzer->nextToken();
-            declarations.push_back(parseConstDecl(t));
-            break;
-        case Token::SubClass::Procedure:
-            _lexicalAnalyzer->nextToken();
-            declarations.push_back(parseProcDecl(t));
-            break;
-        case Token::SubClass::Function:
-            _lexicalAnalyzer->nextToken();
-            declarations.push_back(parseFuncDecl(t));
-            break;
-        default:
-            _symTables->pop_back();
-            return std::make_shared<DeclarationsBlock>(declarations);
-        }
-    }
-};
-
-// la patte
-Node::PNode_t Parser::parseStatement() {
-    Node::VecPNode_t statements;
-    while (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::End) {
-        Token t = _lexicalAnalyzer->currentToken();
-        Node::PNode_t expr = parseExpr();
-        if (expr->_type == Node::Type::Identifier && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Assign) {
-            //checkExpr(expr);
-            Token op = _lexicalAnalyzer->currentToken();
-            std::dynamic_pointer_cast<Identifier>(expr)->isAssignment = true;
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t assignmentExpr = parseExpr();
-            //validateAndReturnExprType(assignmentExpr);
-            //checkExpr(assignmentExpr);
-            validateAssignment(expr, assignmentExpr);
-            statements.push_back(std::make_shared<BinaryOperator>(op, expr, assignmentExpr));
-        }
-        if (expr->_type == Node::Type::FunctionCall) {
-            checkExpr(expr);
-            // TO DO: Add reserved words map, totally forgot they exist
-            if (expr->_children.front()->toString() == "writeln")
-                statements.push_back(std::make_shared<WriteLn>(expr->_children.front()->_token, expr->_children.back()));
-            else if (expr->_children.front()->toString() == "write")
-                statements.push_back(std::make_shared<Write>(expr->_children.front()->_token, expr->_children.back()));
-        };
-        if (t._subClass == Token::SubClass::For) {
-            expect(Token::SubClass::Identifier);
-            Node::PNode_t controlVar = std::make_shared<Identifier>(_lexicalAnalyzer->currentToken());
-            checkExpr(controlVar);
-            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Assign);
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t initial = parseExpr();
-            checkExpr(initial);
-            Node::PNode_t to_downto;
-            if (_lexicalAnalyzer->currentToken().toString() == "to")
-                to_downto = std::make_shared<To>(_lexicalAnalyzer->currentToken());
-            else if (_lexicalAnalyzer->currentToken().toString() == "downto")
-                to_downto = std::make_shared<DownTo>(_lexicalAnalyzer->currentToken());
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t final = parseExpr();
-            checkExpr(final);
-            // Just end my misery
-            expect(Token::SubClass::Do);
-            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t body = parseStatement();
-            expect(Token::SubClass::End);
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t forLoop = std::make_shared<For>(t, initial, to_downto, final, body);
-            controlVar->addChild(initial);
-            controlVar->addChild(final);
-            forLoop->addChild(controlVar);
-            std::swap(forLoop->_children.back(), forLoop->_children.front());
-            statements.push_back(forLoop);
-        };
-        if (t._subClass == Token::SubClass::If) {
-            Node::PNode_t elseBranch = std::make_shared<Node>(Node::Type::StatementBlock);
-            Node::PNode_t condition = parseExpr();
-            checkExpr(condition);
-            expect(Token::SubClass::Then);
-            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
-            _lexicalAnalyzer->nextToken();
-            Node::PNode_t thenBranch = parseStatement();
-            expect(Token::SubClass::End);
-            _lexicalAnalyzer->nextToken();
-            // I deserve to burn in hell
-            if (_lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Else) {
-                expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
-                _lexicalAnalyzer->nextToken();
-                elseBranch = parseStatement();
-                expect(Token::SubClass::End);
-                _lexicalAnalyzer->nextToken();
-            };
-            Node::PNode_t ifStatement = std::make_shared<If>(t, condition, thenBranch, elseBranch);
-            ifStatement->addChild(condition);
-            std::swap(ifStatement->_children.back(), ifStatement->_children.front());
-            statements.push_back(ifStatement);
-        };
-        expect(Token::SubClass::Semicolon);
-        _lexicalAnalyzer->nextToken();
-    };
-    return std::make_shared<StatementsBlock>(statements);
-};
-
-Node::VecPNode_t Parser::parseDeclarations(Token::SubClass separator, bool restrictedInitialization, bool isLocal, bool isParamList) {
-    Node::VecPNode_t declarations;
-    if (isParamList && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::RightParenthesis) {
-        _lexicalAnalyzer->nextToken();
-        return Node::VecPNode_t({});
-    };
-    expect(Token::SubClass::Identifier);
-
-    if (isLocal)
-        _symTables->push_back(std::make_shared<Node::SymTable_t>());
-
-    do {
-    paramListLabel:
-        Node::Type identifierType;
-        Node::VecPNode_t identifiers;
-        if (separator == Token::SubClass::Colon) {
-            identifiers = parseIdentifierList();
-            identifierType = Node::Type::Identifier;
-        }
-        else if (separator == Token::SubClass::Equal) {
-            identifiers.push_back(parseScalarIdentifier());
-            identifiers.back().get()->_type = identifierType = Node::Type::TypeAliasIdentifier;
-        };
-        expect(separator);
-        _lexicalAnalyzer->nextToken();
-        Node::PNode_t type = std::make_shared<TypeNode>(parseType(), identifierType);
-        for (auto i : identifiers) {
-            isLocal ? checkDuplicity(i->_token, _symTables->back()) : checkDuplicity(i->_token);
-            declarations.push_back(std::make_shared<ParentNode>(identifierType, i->_token, type));
-            _symTables->back()->insert({ i->toString(), std::make_pair(type, nullptr) });
-            if (separator == Token::SubClass::Equal)
-                _typeAliases->insert({ i->toString(), std::make_pair(type, nullptr) });
-        };
-
-        if (!restrictedInitialization && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Equal)
-            if (identifiers.size() > 1)
-                throwException(_lexicalAnalyzer->currentToken()._pos, "Can't initialize more than one variable");
-            else {
-                _lexicalAnalyzer->nextToken();
-                Node::PNode_t value = std::make_shared<ValueNode>(parseInitialization(type));
-                declarations.back()->addChild(value);
-                _symTables->back()->operator[](identifiers.back()->toString()).second = value;
-            };
-
-        if (!isParamList) 
-            expect(Token::SubClass::Semicolon);
-        else if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Semicolon)
-            expect(Token::SubClass::RightParenthesis);
-        else {
-            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
-            goto paramListLabel;
-        }
-    } while (_lexicalAnalyzer->nextToken()._subClass == Token::SubClass::Identifier);
-    return declarations;
-};
-
-Node::PNode_t Parser::parseVarDecl(Token t) {
-    return std::make_shared<Declaration>(Node::Type::VarDecl, t, parseDeclarations(Token::SubClass::Colon));
-};
-
-Node::PNode_t Parser::parseTypeDecl(Token t) {
-    Node::VecPNode_t declarations = parseDeclarations(Token::SubClass::Equal, true);
-    for (auto i : *_symTables->back().get())
-        _typeAliases->operator[](i.first) = i.second;
-    return std::make_shared<Declaration>(Node::Type::TypeDecl, t, declarations);
-};
-
-Node::PNode_t Parser::parseProcDecl(Token t) {
-    return std::make_shared<Declaration>(Node::Type::ProcDecl, t, parseProcedure());
-}
-
-Node::PNode_t Parser::parseFuncDecl(Token t) {
-    return std::make_shared<Declaration>(Node::Type::FuncDecl, t, parseFunction());
-}
-
-Node::PNode_t Parser::parseConstDecl(Token t) {
-    Token next, identifier = _lexicalAnalyzer->currentToken();
-    Node::PNode_t type, value, expr;
-    Node::VecPNode_t constants;
-
-    do {
-        switch ((next = _lexicalAnalyzer->nextToken())._subClass) {
-        case Token::SubClass::Colon:
-            _lexicalAnalyzer->nextToken();
-            type = std::make_shared<TypeNode>(parseType(), Node::Type::ConstIdentifier);
-            expect(Token::SubClass::Equal);
-            _lexicalAnalyzer->nextToken();
-            value = std::make_shared<ValueNode>(parseInitialization(type));
-            break;
-        case Token::SubClass::Equal:
-            _lexicalAnalyzer->nextToken();
-            expr = parseConstExpr();
-            type = std::make_shared<TypeNode>(defineConstType(validateAndReturnExprType(expr)), Node::Type::ConstIdentifier);
-            value = std::make_shared<ValueNode>(Node::VecPNode_t({ expr }));
-            break;
-        default:
-            throwException(next._pos, "What a terrible failure");
-            break;
-        };
-
-        expect(Token::SubClass::Semicolon);
-        checkDuplicity(identifier);
-        constants.push_back(std::make_shared<ParentNode>(Node::Type::ConstIdentifier, identifier, type, value));
-        _symTables->back()->insert({ identifier.toString(), std::make_pair(type, value) });
-    } while ((identifier = _lexicalAnalyzer->nextToken())._subClass == Token::SubClass::Identifier);
-    return std::make_shared<Declaration>(Node::Type::ConstDecl, t, constants);
-};
-
-Node::PNode_t Parser::parseConstExpr() {
-    Token t = _lexicalAnalyzer->currentToken();
-    Node::PNode_t expr = parseExpr();
-    Node::Type exprType = validateAndReturnExprType(expr);
-    if (!_reducibleScalarTypes.count(exprType))
-        throwException(t._pos, "Scalar type expected");
-    checkIfExprIsConst(expr);
-    return expr;
-};
-
-void Parser::checkIfExprIsConst(Node::PNode_t expr) {
-    if (expr->_type == Node::Type::BinaryOperator ||
-        expr->_type == Node::Type::UnaryOperator ||
-        expr->_type == Node::Type::IntConst ||
-        expr->_type == Node::Type::FloatConst ||
-        expr->_type == Node::Type::CharConst ||
-        (findSymbol(expr->toString()) &&
-         findSymbol(expr->toString())->first->_children.front()->_type == Node::Type::ConstIdentifier))
-        for (auto i : expr->_children)
-            checkIfExprIsConst(i);
-    else
-        throwException(expr->_token._pos, "Const identifier or expression expected: \"" + expr->toString() + "\"");
-};
-
-// la patte
-Node::PNode_t Parser::parseFunction() {
-    PVecPSymTable_t localSymTable = std::make_shared<VecPSymTable_t>();
-    Node::PSymTable_t localTypeAliases = std::make_shared<Node::SymTable_t>(*_typeAliases.get());
-    localSymTable->push_back(std::make_shared<Node::SymTable_t>());
-    std::swap(localSymTable, _symTables);
-    std::swap(localTypeAliases, _typeAliases);
-
-    Token identifier = _lexicalAnalyzer->currentToken();
-    if (_funcIdentifiersTable->count(identifier.toString()))
-        throwException(identifier._pos, "Duplicate identifier \"" + identifier.toString() + "\"");
-    else 
-        _funcIdentifiersTable->insert(identifier.toString());
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::LeftParenthesis);
-    _lexicalAnalyzer->nextToken();
-
-    Node::PNode_t params = std::make_shared<ParameterList>(parseDeclarations(Token::SubClass::Colon, false, false, true));
-    expect(Token::SubClass::Colon);
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
-
-    Node::PNode_t type = std::make_shared<TypeNode>(parseType(), Node::Type::Type, "return_type");
-    expect(Token::SubClass::Semicolon);
-    _lexicalAnalyzer->nextToken();
-
-    Node::VecPNode_t nodes = std::vector<Node::PNode_t>({ params, type });
-    if (_declKeywords.count(_lexicalAnalyzer->currentToken()._subClass))
-        nodes.push_back(parseDeclaration());
-
-    expect(Token::SubClass::Begin);
-    _lexicalAnalyzer->nextToken();
-    nodes.push_back(parseStatement());
-    expect(Token::SubClass::End);
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
-    _lexicalAnalyzer->nextToken();
-
-    Node::PNode_t result = std::make_shared<Function>(identifier, nodes, params, type, _symTables);
-    std::swap(localSymTable, _symTables);
-    std::swap(localTypeAliases, _typeAliases);
-    _symTables->back()->insert({ identifier.toString(), { type, result } });
-    return result;
-};
-
-// la patte
-Node::PNode_t Parser::parseProcedure() {
-    PVecPSymTable_t localSymTable = std::make_shared<VecPSymTable_t>();
-    Node::PSymTable_t localTypeAliases = std::make_shared<Node::SymTable_t>(*_typeAliases.get());
-    localSymTable->push_back(std::make_shared<Node::SymTable_t>());
-    std::swap(localSymTable, _symTables);
-    std::swap(localTypeAliases, _typeAliases);
-
-    Token identifier = _lexicalAnalyzer->currentToken();
-    if (_funcIdentifiersTable->count(identifier.toString()))
-        throwException(identifier._pos, "Duplicate identifier \"" + identifier.toString() + "\"");
-    else
-        _funcIdentifiersTable->insert(identifier.toString());
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::LeftParenthesis);
-    _lexicalAnalyzer->nextToken(); 
-
-    Node::PNode_t params = std::make_shared<ParameterList>(parseDeclarations(Token::SubClass::Colon, false, false, true));
-    expect(Token::SubClass::Semicolon);
-    _lexicalAnalyzer->nextToken();
-
-    Node::VecPNode_t nodes = std::vector<Node::PNode_t>({ params });
-    if (_declKeywords.count(_lexicalAnalyzer->currentToken()._subClass))
-        nodes.push_back(parseDeclaration());
-
-    expect(Token::SubClass::Begin);
-    _lexicalAnalyzer->nextToken();
-    nodes.push_back(parseStatement());
-    expect(Token::SubClass::End);
-    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
-    _lexicalAnalyzer->nextToken();
-
-    std::shared_ptr<Procedure> result = std::make_shared<Procedure>(identifier, nodes, params, _symTables);
-    std::swap(localSymTable, _symTables);
-    std::swap(localTypeAliases, _typeAliases);
-    _symTables->back()->insert({ identifier.toString(), { nullptr, result } });
-    return result;
-};
-
-Node::PNode_t Parser::parseType() {
-    Token t;
-    Token current = _lexicalAnalyzer->currentToken();
-    Token next = _lexicalAnalyzer->nextToken();
-    Node::Type type = defineNodeType(current);
-    Node::PNode_t left, right, result;
-    Node::VecPNode_t fields;
-
-    switch (type) {
-    case Node::Type::Integer:
-    case Node::Type::Float:
-    case Node::Type::Char:
-    case Node::Type::String:
-        if (next._subClass == Token::SubClass::Subrange)
-            throwException(current._pos, "Error in type definition");
-        return std::make_shared<Node>(type, current);
-    case Node::Type::TypeAliasIdentifier:
-        return findSymbol(current._value.s, _typeAliases)->first->_children.back();
-        //without sym table
-        //if (next._subClass != Token::SubClass::Subrange)
-        //    return std::make_shared<TypeAlias>(current);
-    case Node::Type::ConstIdentifier:
-        expect(findSymbol(current._value.s)->second->_children.back()->_token, Token::SubClass::IntConst);
-    case Node::Type::IntConst:
-        left = std::make_shared<Node>(type, current);
-        if (type == Node::Type::ConstIdentifier) {
-            left->addChild(findSymbol(current._value.s)->first);
-            left->addChild(findSymbol(current._value.s)->second);
-        };
-        expect(t = next, Token::SubClass::Subrange);
-        next = _lexicalAnalyzer->nextToken();
-        if (next._subClass == Token::SubClass::IntConst)
-            right = std::make_shared<IntConst>(next);
-        else if (defineNodeType(next) == Node::Type::ConstIdentifier) {
-            right = std::make_shared<Node>(Node::Type::ConstIdentifier, next);
-            right->addChild(findSymbol(next._value.s)->first);
-            right->addChild(findSymbol(next._value.s)->second);
-        }
-        //without semantics
-        //else if (next._subClass == Token::SubClass::Identifier && _identifierNodeTypes.count(next._value.s) == 0)
-        //    right = std::make_shared<TypeAlias>(next);
-        else
-            throwException(next._pos, "Error in type definition");
-        result = std::make_shared<Subrange>(t, left, right);
-        _lexicalAnalyzer->nextToken();
-        break;
-    case Node::Type::Record:
-        fields = parseDeclarations(Token::SubClass::Colon, true, true);
-        result = std::make_shared<Record>(current, fields, _symTables->back());
-        _symTables->pop_back();
-        expect(Token::SubClass::End);
-        _lexicalAnalyzer->nextToken();
-        break;
-    case Node::Type::Array:
-        result = std::make_shared<Node>(type, current);
-        expect(next, Token::SubClass::LeftBracket);
-        _lexicalAnalyzer->nextToken();
-        result->addChild(parseType());
-        expect(result->_children.back()->_token, Token::SubClass::Subrange);
-        expect(Token::SubClass::RightBracket);
-        expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Of);
-        _lexicalAnalyzer->nextToken();
-        result->addChild(std::make_shared<TypeNode>(parseType(), Node::Type::Type));
-        break;
-    }
-        return result;
-};
-
-Node::VecPNode_t Parser::parseInitialization(Node::PNode_t typeNode) {
-    Node::PNode_t result, type = typeNode->_children.back();
-    Node::VecPNode_t values, nodes;
-    std::map<Node::PNode_t, bool> initialized;
-    uint64_t lowerBound, upperBound;
-
-    Node::Type currentType = type->_type;
-    switch (currentType) {
-    case Node::Type::Integer:
-    case Node::Type::IntConst:
-    case Node::Type::Subrange:
-    case Node::Type::Float:
-    case Node::Type::FloatConst:
-    case Node::Type::String:
-    case Node::Type::Char:
-    case Node::Type::CharConst:
-        checkExprType(result = parseExpr(), _ordinalInitializers.at(currentType));
-        values.push_back(result);
-        break;
-    case Node::Type::Array:
-        lowerBound = std::dynamic_pointer_cast<Subrange>(type->_children.front())->_lowerBound;
-        upperBound = std::dynamic_pointer_cast<Subrange>(type->_children.front())->_upperBound;
-        expect(Token::SubClass::LeftParenthesis);
-        for (uint64_t i = lowerBound; i <= upperBound; ++i) {
-            _lexicalAnalyzer->nextToken();
-            for (auto j : parseInitialization(type->_children.back()))
-                nodes.push_back(j);
-            if (i < upperBound)
-                expect(Token::SubClass::Comma);
-        };
-        expect(Token::SubClass::RightParenthesis);
-        values.push_back(std::make_shared<ValueNode>(nodes, "array"));
-        _lexicalAnalyzer->nextToken();
-        break;
-    case Node::Type::Record:
-        expect(Token::SubClass::LeftParenthesis);
-        for (auto i : type->_children) {
-            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
-            if (!std::strcmp(_lexicalAnalyzer->currentToken()._value.s, i->_token._value.s)) {
-                expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Colon);
-                _lexicalAnalyzer->nextToken();
-                values.push_back(std::make_shared<ParentNode>(Node::Type::Identifier, i->_token, parseInitialization(i->_children.back())));
-                initialized.insert({i, true});
-            }
-            else {
-                for (auto j : type->_children)
-                    if (!std::strcmp(_lexicalAnalyzer->currentToken()._value.s, j->_token._value.s))
-                        if (initialized.count(j))
-                            throwException(_lexicalAnalyzer->currentToken()._pos, "Field has already been initialized");
-                        else if (&j != &i)
-                            throwException(_lexicalAnalyzer->currentToken()._pos, "Incorrect initialization order");
-                throwException(_lexicalAnalyzer->currentToken()._pos, "Unknown field");
-            };
-            expect(Token::SubClass::Semicolon);
-        };
-        expect(_lexicalAnalyzer->nextToken(), Token::SubClass::RightParenthesis);
-        _lexicalAnalyzer->nextToken();
-        break;
-    default:
-        throwException(_lexicalAnalyzer->currentToken()._pos, "Can't initialize variable of this type");
-    }
-    return values;
-};
-
-Node::Type Parser::defineNodeType(Token t) {
-    if (t._subClass == Token::SubClass::Identifier)
-        if (_identifierNodeTypes.count(t._value.s) && !findSymbol(t._value.s))
-            return _identifierNodeTypes.at(t._value.s);
-        //without sym table
-        //else return Node::Type::TypeAliasIdentifier;
-        else if (findSymbol(t._value.s) && 
-                 std::dynamic_pointer_cast<TypeNode>(findSymbol(t._value.s)->first)->isConst())
-            return Node::Type::ConstIdentifier;
-        else if (findSymbol(t._value.s, _typeAliases) && 
-                 std::dynamic_pointer_cast<TypeNode>(findSymbol(t._value.s, _typeAliases)->first)->isTypeAlias())
-            return Node::Type::TypeAliasIdentifier;
-    if (_subClassNodeTypes.count(t._subClass))
-        return _subClassNodeTypes.at(t._subClass);
-    throwException(t._pos, "Error in type definition");
-};
-
-Node::PNode_t Parser::defineConstType(Node::Type type) {
-    switch (type) {
-    case Node::Type::Float:
-        return std::make_shared<NamedNode>(Node::Type::FloatConst, "real");
-    case Node::Type::Char:
-        //return t.toString().length() > 1 ?
-            //std::make_shared<NamedNode>(Node::Type::StringLiteral, "string") :
-            std::make_shared<NamedNode>(Node::Type::CharConst, "char");
-    case Node::Type::Integer:
-        return std::make_shared<NamedNode>(Node::Type::IntConst, "integer");
-    default:
-        break;
-    }
-};
-
-Node::PNode_t Parser::defineConstType(Token t) {
-    switch (t._vtype) {
-    case Token::ValueType::Double:
-        return std::make_shared<NamedNode>(Node::Type::FloatConst, "real");
-    case Token::ValueType::String:
-        return t.toString().length() > 1 ?
-               std::make_shared<NamedNode>(Node::Type::StringLiteral, "string") :
-               std::make_shared<NamedNode>(Node::Type::CharConst, "char");
-    case Token::ValueType::ULL:
-        return std::make_shared<NamedNode>(Node::Type::IntConst, "integer");
-    default:
-        throwException(t._pos, "Error in const definition");
-    }
-};
-
-Parser::PNodePair_t* Parser::findSymbol(std::string name) {
-    for (auto it = _symTables->rbegin(); it != _symTables->rend(); ++it)
-        if (it->get()->count(name))
-            return &(it->get()->at(name));
-    return nullptr;
-};
-
-Parser::PNodePair_t* Parser::findSymbol(std::string name, Node::PSymTable_t symTable) {
-    if (symTable->count(name))
-        return &(symTable->at(name));
-    return nullptr;
-};
-
-Node::PNode_t Parser::parseScalarIdentifier() {
-    expect(Token::SubClass::Identifier);
-    Node::PNode_t node(new Identifier(_lexicalAnalyzer->currentToken()));
-    _lexicalAnalyzer->nextToken();
-    return node;
-};
-
-Node::VecPNode_t Parser::parseIdentifierList() {
-    Node::VecPNode_t identifiers;
-    do {
-        identifiers.push_back(parseScalarIdentifier());
-        if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Comma)
-            break;
-        _lexicalAnalyzer->nextToken();
-    } while (true);
-    return identifiers;
-};
-
-Node::PNode_t Parser::parseBinOp(Parser::Precedence p, Parser::PNodeFunction_t pf) {
-    Node::PNode_t left = (this->*pf)();
-    Token t = _lexicalAnalyzer->currentToken();
-    while (checkPrecedence(p, t._subClass)) {
-        _lexicalAnalyzer->nextToken();
-        left = std::make_shared<BinaryOperator>(t, left, (this->*pf)());
-        t = _lexicalAnalyzer->currentToken();
-    }
-    return left;
-};
-
-Node::PNode_t Parser::parseExpr() {
-    return parseBinOp(Precedence::Last, &Parser::parseSimpleExpr);
-};
-Node::PNode_t Parser::parseSimpleExpr() {
-    return parseBinOp(Precedence::Third, &Parser::parseTerm);
-};
-Node::PNode_t Parser::parseTerm() {
-    return parseBinOp(Precedence::Second, &Parser::parseFactor);
-};
-
-Node::PNode_t Parser::parseFactor() {
-    Node::PNode_t e;
-    Token t = _lexicalAnalyzer->currentToken();
-    _lexicalAnalyzer->nextToken();
-    if (checkPrecedence(Parser::Precedence::First, t._subClass))
-        return std::make_shared<UnaryOperator>(t, parseExpr());
-    switch (t._subClass) {
-    case Token::SubClass::Identifier:
-        return parseIdentifier(t);
-        break;
-    case Token::SubClass::IntConst:
-        return std::make_shared<IntConst>(t);
-        break;
-    case Token::SubClass::FloatConst:
-        return std::make_shared<FloatConst>(t);
-        break;
-    case Token::SubClass::StringLiteral:
-        if (t._raw.length() == 3)
-            return std::make_shared<CharConst>(t);
-        else
-            return std::make_shared<StringLiteral>(t);        
-        break;
-    case Token::SubClass::LeftParenthesis:
-        e = parseExpr();
-        expect(Token::SubClass::RightParenthesis);
-        _lexicalAnalyzer->nextToken();
-        return e;
-        break;
-    case Token::SubClass::For:
-    case Token::SubClass::To:
-    case Token::SubClass::DownTo:
-    case Token::SubClass::Do:
-    case Token::SubClass::If:
-    case Token::SubClass::Then:
-    case Token::SubClass::Else:
-        return std::make_shared<ReservedWord>(t);
-        break;
-    case Token::SubClass::EndOfFile:
-        throwException(t._pos, "Unexpected end of file");
-        break;
-    default:
-        throwException(t._pos, "Illegal expression");
-        break;
-    }
-};
-
-Node::PNode_t Parser::parseIdentifier(Token t) {
-    Node::VecPNode_t args;
-    Node::PNode_t identifier = std::make_shared<Identifier>(t);
-    std::set<Token::SubClass> allowed = { 
-        Token::SubClass::Dot, 
-        Token::SubClass::LeftBracket, 
-        Token::SubClass::LeftParenthesis 
-    };
-    while (allowed.count(_lexicalAnalyzer->currentToken()._subClass)) {
-        Token t = _lexicalAnalyzer->currentToken();
-        _lexicalAnalyzer->nextToken();
-        switch (t._subClass) {
-            case Token::SubClass::Dot:
-                identifier = std::make_shared<RecordAccess>(identifier, parseScalarIdentifier());
-                break;
-            case Token::SubClass::LeftBracket:
-                identifier = std::make_shared<ArrayIndex>(identifier, parseExpr());
-                expect(Token::SubClass::RightBracket);
-                _lexicalAnalyzer->nextToken();
-                break;
-            case Token::SubClass::LeftParenthesis:
-                if (identifier->_type != Node::Type::Identifier)
-                    throwException(t._pos, "Illegal function call");
-                identifier = std::make_shared<FunctionCall>(identifier, parseArgs());
-                expect(Token::SubClass::RightParenthesis);
-                _lexicalAnalyzer->nextToken();
-                break;
-            default:
-                break;
-        }
-    }
-    return identifier;
-};
-
-Node::VecPNode_t Parser::parseArgs() {
-    Node::VecPNode_t args; 
-    if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::RightParenthesis)
-        do {
-            args.push_back(parseExpr());
-            if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Comma)
-                break;
-            _lexicalAnalyzer->nextToken();
-        } while (true);
-    return args;
-};
-
-void Parser::buildTree() {
-    _root = parseProgram();
-    int offset;
-    //for (auto i : *_symTables.get())
-    //    for (auto j : *i.get()) {
-    //        if (!std::dynamic_pointer_cast<TypeNode>(j.second.first)->isTypeAlias()) {
-    //            offset = AsmCode::getTypeSize(j.second.first->_children.front());
-    //            AsmCode::_offset += offset;
-    //            AsmCode::_offsetMap[j.first] = { offset, AsmCode::_offset };
-    //        }
-    //    };
-    //AsmCode::PAsmCommand setOffset = std::make_shared<AsmCommand>(AsmCommands::Enter, std::vector<std::string>({ std::to_string(AsmCode::_offset), "1" }));
-    //AsmCode::addCommand(setOffset);
-    //AsmCode::generateStatements(_root->_children.back());
-    //AsmCode::generate(std::ofstream("code.asm"));
-};
-
-template<typename T>
-void Parser::open(T filename) {
-    _lexicalAnalyzer = std::make_shared<LexicalAnalyzer>(filename);
-};
-
-void Parser::visualizeTree(std::wostream& os, Node::PNode_t node, bool isLastChild = true,
-                           std::vector<std::pair<int, bool>> margins = std::vector<std::pair<int, bool>>(0)) {
-    for (auto i : margins) {
-        if (i.second)
-            os << L'│';
-        for (auto j = 0; j < (i.first - i.second) - 1; ++j)
-            os << " ";
-    };
-    os << (isLastChild ? L'└' : L'├') << L'─' << node->toString().c_str() << std::endl;
-
-    for (auto i : node->_children) {
-        margins.push_back({ node->toString().length() + 2, !isLastChild });
-        visualizeTree(os, i, i == node->_children.back(), margins);
-        margins.pop_back();
-    };
-};
-
-void Parser::log(std::wostream& os) {
-    try {
-        buildTree();
-    }
-    catch (std::exception e) {
-        os << e.what();
-        return;
-    }
-    visualizeTree(os, _root);
-};
-
-void Parser::expect(Token::SubClass expected) {
-    expect(_lexicalAnalyzer->currentToken(), expected);
-};
-
-void Parser::expect(Token t, Token::SubClass expected) {
-    std::stringstream ss;
-    if (expected != t._subClass) {
-        if (t._subClass == Token::SubClass::EndOfFile)
-            throwException(t._pos, "Unexpected end of file");
-        else {
-            ss << "Syntax error, \""
-                << _lexicalAnalyzer->_subClassDict.at(expected)
-                << "\" expected, but \""
-                << _lexicalAnalyzer->_subClassDict.at(t._subClass)
-                << "\" found";
-            throwException(t._pos, ss.str());
-        }
-    }
-};
-
-void Parser::expect(Token t, Node::Type received, Node::Type expected) {
-    std::stringstream ss;
-    if (received != expected) {
-        ss << "Incompatible types: \""
-           << _nodeTypes.at(expected)
-           << "\" expected, but \""
-           << _nodeTypes.at(received)
-           << "\" found";
-        throwException(t._pos, ss.str());
-    }
-};
-
-bool Parser::checkPrecedence(Parser::Precedence p, Token::SubClass s) {
-    return _precedences.at(static_cast<int>(p)).count(s) ? true : false;
-};
-
-void Parser::checkExprType(Node::PNode_t expr, Node::Type type) {
-    if (expr->_children.size()) {
-        for (auto i : expr->_children)
-            checkExprType(i, type);
-        return;
-    };
-    expect(expr->_token, expr->_type, type);
-};
-
-void Parser::checkExpr(Node::PNode_t expr) {
-    if (expr->_type == Node::Type::Identifier) {
-        if (expr->toString() != "write" && expr->toString() != "writeln")
-            if (!findSymbol(expr->toString()))
-                throwException(expr->_token._pos, "Identifier not found: \"" + expr->toString() + "\"");
-            else if (!_funcIdentifiersTable->count(expr->toString())) {
-                if (std::dynamic_pointer_cast<TypeNode>(findSymbol(expr->_token._value.s)->first)->isConst())
-                    throwException(expr->_token._pos, "Can't modify constant values: \"" + expr->toString() + "\"");
-                else if (std::dynamic_pointer_cast<TypeNode>(findSymbol(expr->_token._value.s)->first)->isTypeAlias())
-                    throwException(expr->_token._pos, "Can't modify type aliases: \"" + expr->toString() + "\"");
-            };
-    };
-    
-    for (auto i : expr->_children)
-        checkExpr(i);
-};
-
-Node::Type Parser::validateAndReturnExprType(Node::PNode_t expr) {
-    if (expr->_type == Node::Type::BinaryOperator) {
-        Node::PNode_t left = expr->_children.front();
-        Node::PNode_t right = expr->_children.back();
-        Node::Type leftType = validateAndReturnExprType(left);
-        Node::Type rightType = validateAndReturnExprType(right);
-        if (leftType == Node::Type::Char || rightType == Node::Type::Char)
-            throwException(expr->_token._pos, "Can't apply operator \"" + expr->toString() + "\" to char");
-        if (leftType == Node::Type::Array || rightType == Node::Type::Array)
-            throwException(expr->_token._pos, "Can't apply operator \"" + expr->toString() + "\" to array");
-        if (leftType == Node::Type::Record || rightType == Node::Type::Record)
-            throwException(expr->_token._pos, "Can't apply operator \"" + expr->toString() + "\" to record");
-        if (leftType == Node::Type::FunctionCall || rightType == Node::Type::FunctionCall)
-            throwException(expr->_token._pos, "Can't use procedures in expressions");
-        if (expr->_token._subClass == Token::SubClass::Add ||
-            expr->_token._subClass == Token::SubClass::Sub ||
-            expr->_token._subClass == Token::SubClass::Mult) {
-            if (leftType == rightType)
-                return leftType;
-            else if ((leftType == Node::Type::Integer && rightType == Node::Type::Float) ||
-                (leftType == Node::Type::Float && rightType == Node::Type::Integer))
-                return Node::Type::Float;
-        }
-        else if (expr->_token._subClass == Token::SubClass::SHL ||
-            expr->_token._subClass == Token::SubClass::SHR ||
-            expr->_token._subClass == Token::SubClass::And ||
-            expr->_token._subClass == Token::SubClass::Or ||
-            expr->_token._subClass == Token::SubClass::Mod ||
-            expr->_token._subClass == Token::SubClass::Div) {
-            if ((leftType == Node::Type::Float) || (rightType == Node::Type::Integer) ||
-                (leftType == Node::Type::Char) || (rightType == Node::Type::Char))
-                throwException(expr->_token._pos, "Can't apply operator \"" + expr->toString() + "\" to other than integers");
-            else if (expr->_token._subClass == Token::SubClass::Div)
-                return Node::Type::Float;
-            else
-                return Node::Type::Integer;
-        }
-        else if (expr->_token._subClass == Token::SubClass::Equal ||
-                 expr->_token._subClass == Token::SubClass::Less ||
-                 expr->_token._subClass == Token::SubClass::More ||
-                 expr->_token._subClass == Token::SubClass::LEQ ||
-                 expr->_token._subClass == Token::SubClass::MEQ ||
-                 expr->_token._subClass == Token::SubClass::NEQ) 
-            if (leftType == Node::Type::Char || rightType == Node::Type::Char)
-                throwException(expr->_token._pos, "Can't apply operator \"" + expr->toString() + "\" to chars");
-            else
-                return Node::Type::Integer;
-    }
-    else if (expr->_type == Node::Type::UnaryOperator)
-        return validateAndReturnExprType(expr->_children.front());
-    else if (expr->_type == Node::Type::FunctionCall) {
-        if (!findSymbol(expr->_children.front()->toString()))
-            throwException(expr->_children.front()->_token._pos, "Identifier not found: \"" + expr->_children.front()->toString() + "\"");
-        else if (!_funcIdentifiersTable->count(expr->_children.front()->toString()))
-            throwException(expr->_children.front()->_token._pos, "Identifier's not a function or a procedure: \"" + expr->_children.front()->toString() + "\"");
-        if (findSymbol(expr->_children.front()->toString())->first) {
-            Function* f = std::static_pointer_cast<Function>(findSymbol(expr->_children.front()->toString())->second).get();
-            Node::VecPNode_t params = std::static_pointer_cast<ParameterList>(f->_paramList)->getParams();
-            if (params.size() != expr->_children.size() - 1)
-                throwException(expr->_children.front()->_token._pos, "Wrong amount of arguments in function call \"" + expr->_children.front()->toString() + "\"");
-            //for (size_t i = 1; i < expr->_children.size(); ++i) {
-            //    if (findSymbol(expr->_children[i]->toString())) /////////// validate
-            //        validateNodeTypes(params[i - 1], findSymbol(expr->_children[i]->toString())->first->_children.front(), expr->_children[i]->_token._pos);
-            //    else
-            //        validateNodeTypes(params[i - 1], expr->_children[i], expr->_children[i]->_token._pos);
-            //}
-            return findSymbol(expr->_children.front()->toString())->first->_children.front()->_type;
-        }
-        else
-            return Node::Type::FunctionCall;
-    }
-    else if (expr->_type == Node::Type::Identifier) {
-        if (_funcIdentifiersTable->count(expr->toString()))
-            throwException(expr->_token._pos, "Improper call of a function or a procedure: \"" + expr->toString() + "\"");
-        return findSymbol(expr->toString())->first->_children.front()->_type;
-    }
-    else if (expr->_type == Node::Type::IntConst)
-        return Node::Type::Integer;
-    else if (expr->_type == Node::Type::FloatConst)
-        return Node::Type::Float;
-    else if (expr->_type == Node::Type::CharConst)
-        return Node::Type::Char;
-    else return expr->_type;
-};
-
-void Parser::validateNodeTypes(Node::PNode_t leftTypeNode, Node::PNode_t rightTypeNode, const Token::Position_t pos) {
-    if (leftTypeNode->_type == rightTypeNode->_type) {
-        if (leftTypeNode->_type == Node::Type::Subrange)
-            if ((std::static_pointer_cast<Subrange>(leftTypeNode)->_lowerBound != 
-                std::static_pointer_cast<Subrange>(rightTypeNode)->_lowerBound) ||
-                (std::static_pointer_cast<Subrange>(leftTypeNode)->_upperBound !=
-                 std::static_pointer_cast<Subrange>(rightTypeNode)->_upperBound))
-            throwException(pos, "Incompatible types");
-        if (leftTypeNode->_children.size() == rightTypeNode->_children.size())
-            for (size_t i = 0; i < leftTypeNode->_children.size(); ++i)
-                validateNodeTypes(leftTypeNode->_children[i], rightTypeNode->_children[i], pos);
-        else
-            throwException(pos, "Incompatible types");
-    }
-    else
-        throwException(pos, "Incompatible types");
-};
-
-void Parser::validateAssignment(Node::PNode_t left, Node::PNode_t right) {
-    checkExpr(left);
-    checkExpr(right);
-    Node::Type leftType = validateAndReturnExprType(left);
-    Node::Type rightType = validateAndReturnExprType(right);
-    if ((_reducibleScalarTypes.count(leftType) && !_reducibleScalarTypes.count(rightType)) ||
-        (!_reducibleScalarTypes.count(leftType) && _reducibleScalarTypes.count(rightType)))
-        throwException(right->_token._pos, "Can't assign operand of this type");
-    else if (!_reducibleScalarTypes.count(leftType) && !_reducibleScalarTypes.count(rightType))
-        validateNodeTypes(findSymbol(left->toString())->first, findSymbol(right->toString())->first, right->_token._pos);
-};
-
-void Parser::checkDuplicity(Token t) {
-    if (findSymbol(t.toString())) 
-        throwException(t._pos, "Duplicate identifier \"" + t.toString() + "\"");
-};
-
-void Parser::checkDuplicity(Token t, Node::PSymTable_t symTable) {
-    if (findSymbol(t.toString(), symTable))
-        throwException(t._pos, "Duplicate identifier \"" + t.toString() + "\"");
-};
-
-void Parser::throwException(Token::Position_t pos, std::string msg) {
-    std::stringstream ss;
-    ss << "(" << pos.first << ", " << pos.second << "): " << msg.c_str();
-    throw std::exception(ss.str().c_str());
+﻿#include "Parser.hpp"
+#include <atomic>
+#include <thread>
+
+unsigned Parser::_threads = 1;
+
+
+// Relational operators bind loosest, then the additive and the multiplicative ones; all are
+// left associative. Unary operators are read as prefixes of a whole expression.
+constexpr Parser::OperatorTable_t Parser::buildOperators() {
+    OperatorTable_t operators = {};
+    for (Token::SubClass s : { Token::SubClass::Equal, Token::SubClass::NEQ, Token::SubClass::Less, Token::SubClass::More,
+                               Token::SubClass::LEQ, Token::SubClass::MEQ, Token::SubClass::In })
+        operators[static_cast<size_t>(s)].power = 1;
+    for (Token::SubClass s : { Token::SubClass::Add, Token::SubClass::Sub, Token::SubClass::Or, Token::SubClass::Xor })
+        operators[static_cast<size_t>(s)].power = 2;
+    for (Token::SubClass s : { Token::SubClass::Mult, Token::SubClass::Div, Token::SubClass::IntDiv, Token::SubClass::Mod,
+                               Token::SubClass::And, Token::SubClass::SHL, Token::SubClass::SHR })
+        operators[static_cast<size_t>(s)].power = 3;
+    for (Token::SubClass s : { Token::SubClass::Not, Token::SubClass::Add, Token::SubClass::Sub, Token::SubClass::Address,
+                               Token::SubClass::Exp })
+        operators[static_cast<size_t>(s)].prefix = true;
+    return operators;
+};
+
+constexpr Parser::OperatorTable_t Parser::_operators = Parser::buildOperators();
+
+const std::set<Node::Type> Parser::_reducibleScalarTypes = {
+    Node::Type::Integer,
+    Node::Type::Float,
+    Node::Type::Char,
+};
+
+const Parser::NodeTypesDict_t Parser::_nodeTypes = {
+    { Node::Type::Identifier,      "Identifier"      },
+    { Node::Type::ConstIdentifier, "ConstIdentifier" },
+    { Node::Type::Integer,         "Integer"         },
+    { Node::Type::Float,           "Real"            },
+    { Node::Type::Char,            "Char"            },
+    { Node::Type::Subrange,        "Subrange"        },
+    { Node::Type::String,          "String"          },
+    { Node::Type::Record,          "Record"          },
+    { Node::Type::Array,           "Array"           },
+    { Node::Type::IntConst,        "IntConst"        },
+    { Node::Type::FloatConst,      "FloatConst"      },
+    { Node::Type::CharConst,       "CharConst"       },
+    { Node::Type::StringLiteral,   "StringLiteral"   },
+};
+
+const Parser::SubClassTypeDict_t Parser::_subClassNodeTypes = {
+    { Token::SubClass::IntConst,   Node::Type::IntConst   },
+    { Token::SubClass::FloatConst, Node::Type::FloatConst },
+    { Token::SubClass::String,     Node::Type::String     },
+    { Token::SubClass::Array,      Node::Type::Array      },
+    { Token::SubClass::Record,     Node::Type::Record     },
+};
+
+const Parser::OrdinalInitializersDict_t Parser::_ordinalInitializers = {
+    { Node::Type::Integer,     Node::Type::IntConst      },
+    { Node::Type::IntConst,    Node::Type::IntConst      },
+    { Node::Type::Subrange,    Node::Type::IntConst      },
+    { Node::Type::Float,       Node::Type::FloatConst    },
+    { Node::Type::FloatConst,  Node::Type::FloatConst    },
+    { Node::Type::String,      Node::Type::StringLiteral },
+    { Node::Type::Char,        Node::Type::CharConst     },
+    { Node::Type::CharConst,   Node::Type::CharConst     },
+};
+
+const Parser::IdentifierTypeDict_t Parser::_identifierNodeTypes = {
+    { "integer", Node::Type::Integer },
+    { "char",    Node::Type::Char    },
+    { "real",    Node::Type::Float   },
+};
+
+const Parser::DeclarationsKeywordsSet_t Parser::_declKeywords = {
+    Token::SubClass::Var,
+    Token::SubClass::Type,
+    Token::SubClass::Const,
+    Token::SubClass::Procedure,
+    Token::SubClass::Function
+};
+
+Parser::Parser() : _root(nullptr), _skimBodies(false), _errorOffset(NoOffset), _writeSymbol(Interner::intern("write")), _writelnSymbol(Interner::intern("writeln")) {};
+
+Parser::Parser(const char* filename) : Parser() {
+    open(filename);
+};
+
+// Node types that own children take the arena for their child array as first argument
+template<typename T, typename... Args>
+T* Parser::make(Args&&... args) {
+    if constexpr (std::is_constructible_v<T, Arena&, Args&&...>)
+        return _nodes.make<T>(_nodes, std::forward<Args>(args)...);
+    else
+        return _nodes.make<T>(std::forward<Args>(args)...);
+};
+
+Node::PNode_t Parser::parseProgram() {
+    _routines.clear();
+    _symbols.clear();
+    _typeAliases.clear();
+    Node::PNode_t program = parseProgramHeading();
+    if (_declKeywords.count(_lexicalAnalyzer->currentToken()._subClass))
+        program->addChild(_nodes, parseDeclaration());
+    expect(Token::SubClass::Begin);
+    _lexicalAnalyzer->nextToken();
+    if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::End)
+        program->addChild(_nodes, parseStatement());
+    expect(Token::SubClass::End);
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Dot);
+    return program;
+};
+
+Node::PNode_t Parser::parseProgramHeading() {
+    Node::PNode_t heading;
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Program);
+    heading = make<Node>(Node::Type::Program, _lexicalAnalyzer->currentToken());
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
+    heading->addChild(_nodes, make<Identifier>(_lexicalAnalyzer->currentToken()));
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
+    _lexicalAnalyzer->nextToken();
+    return heading;
+};
+
+Node::PNode_t Parser::parseDeclaration() {
+    Node::VecPNode_t declarations;
+    while (true) {
+        Token t = _lexicalAnalyzer->currentToken();
+        switch (t._subClass) {
+        case Token::SubClass::Var:
+            _lexicalAnalyzer->nextToken();
+            declarations.push_back(parseVarDecl(t));
+            break;
+        case Token::SubClass::Type:
+            _lexicalAnalyzer->nextToken();
+            declarations.push_back(parseTypeDecl(t));
+            break;
+        case Token::SubClass::Const:
+            _lexicalAnalyzer->nextToken();
+            declarations.push_back(parseConstDecl(t));
+            break;
+        case Token::SubClass::Procedure:
+            _lexicalAnalyzer->nextToken();
+            declarations.push_back(parseProcDecl(t));
+            break;
+        case Token::SubClass::Function:
+            _lexicalAnalyzer->nextToken();
+            declarations.push_back(parseFuncDecl(t));
+            break;
+        default:
+            return make<DeclarationsBlock>(declarations);
+        }
+    }
+};
+
+// la patte
+Node::PNode_t Parser::parseStatement() {
+    Node::VecPNode_t statements;
+    while (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::End) {
+        Token t = _lexicalAnalyzer->currentToken();
+        Node::PNode_t expr = parseExpr();
+        if (expr->_type == Node::Type::Identifier && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Assign) {
+            //checkExpr(expr);
+            Token op = _lexicalAnalyzer->currentToken();
+            dynamic_cast<Identifier*>(expr)->isAssignment = true;
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t assignmentExpr = parseExpr();
+            //validateAndReturnExprType(assignmentExpr);
+            //checkExpr(assignmentExpr);
+            validateAssignment(expr, assignmentExpr);
+            statements.push_back(make<BinaryOperator>(op, expr, assignmentExpr));
+        }
+        if (expr->_type == Node::Type::FunctionCall) {
+            checkExpr(expr);
+            // TO DO: Add reserved words map, totally forgot they exist
+            if (expr->_children.front()->symbol() == _writelnSymbol)
+                statements.push_back(make<WriteLn>(expr->_children.front()->_token, expr->_children.back()));
+            else if (expr->_children.front()->symbol() == _writeSymbol)
+                statements.push_back(make<Write>(expr->_children.front()->_token, expr->_children.back()));
+        };
+        if (t._subClass == Token::SubClass::For) {
+            expect(Token::SubClass::Identifier);
+            Node::PNode_t controlVar = make<Identifier>(_lexicalAnalyzer->currentToken());
+            checkExpr(controlVar);
+            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Assign);
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t initial = parseExpr();
+            checkExpr(initial);
+            Node::PNode_t to_downto;
+            if (_lexicalAnalyzer->currentToken()._subClass == Token::SubClass::To)
+                to_downto = make<To>(_lexicalAnalyzer->currentToken());
+            else if (_lexicalAnalyzer->currentToken()._subClass == Token::SubClass::DownTo)
+                to_downto = make<DownTo>(_lexicalAnalyzer->currentToken());
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t final = parseExpr();
+            checkExpr(final);
+            // Just end my misery
+            expect(Token::SubClass::Do);
+            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t body = parseStatement();
+            expect(Token::SubClass::End);
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t forLoop = make<For>(t, initial, to_downto, final, body);
+            controlVar->addChild(_nodes, initial);
+            controlVar->addChild(_nodes, final);
+            forLoop->addChild(_nodes, controlVar);
+            std::swap(forLoop->_children.back(), forLoop->_children.front());
+            statements.push_back(forLoop);
+        };
+        if (t._subClass == Token::SubClass::If) {
+            Node::PNode_t elseBranch = make<Node>(Node::Type::StatementBlock);
+            Node::PNode_t condition = parseExpr();
+            checkExpr(condition);
+            expect(Token::SubClass::Then);
+            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
+            _lexicalAnalyzer->nextToken();
+            Node::PNode_t thenBranch = parseStatement();
+            expect(Token::SubClass::End);
+            _lexicalAnalyzer->nextToken();
+            // I deserve to burn in hell
+            if (_lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Else) {
+                expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Begin);
+                _lexicalAnalyzer->nextToken();
+                elseBranch = parseStatement();
+                expect(Token::SubClass::End);
+                _lexicalAnalyzer->nextToken();
+            };
+            Node::PNode_t ifStatement = make<If>(t, condition, thenBranch, elseBranch);
+            ifStatement->addChild(_nodes, condition);
+            std::swap(ifStatement->_children.back(), ifStatement->_children.front());
+            statements.push_back(ifStatement);
+        };
+        expect(Token::SubClass::Semicolon);
+        _lexicalAnalyzer->nextToken();
+    };
+    return make<StatementsBlock>(statements);
+};
+
+Node::VecPNode_t Parser::parseDeclarations(Token::SubClass separator, bool restrictedInitialization, bool isLocal, bool isParamList) {
+    Node::VecPNode_t declarations;
+    if (isParamList && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::RightParenthesis) {
+        _lexicalAnalyzer->nextToken();
+        return Node::VecPNode_t({});
+    };
+    expect(Token::SubClass::Identifier);
+
+    if (isLocal)
+        _symbols.pushScope();
+
+    do {
+    paramListLabel:
+        Node::Type identifierType;
+        Node::VecPNode_t identifiers;
+        if (separator == Token::SubClass::Colon) {
+            identifiers = parseIdentifierList();
+            identifierType = Node::Type::Identifier;
+        }
+        else if (separator == Token::SubClass::Equal) {
+            identifiers.push_back(parseScalarIdentifier());
+            identifiers.back()->_type = identifierType = Node::Type::TypeAliasIdentifier;
+        };
+        expect(separator);
+        _lexicalAnalyzer->nextToken();
+        Node::PNode_t type = make<TypeNode>(parseType(), identifierType);
+        SymbolTable::Binding_t binding;
+        for (auto i : identifiers) {
+            checkDuplicity(i->_token, isLocal);
+            declarations.push_back(make<ParentNode>(identifierType, i->_token, type));
+            binding = _symbols.declare(i->symbol(), { type, nullptr }, i->_token._offset);
+            if (separator == Token::SubClass::Equal)
+                _typeAliases.declare(i->symbol(), { type, nullptr }, i->_token._offset);
+        };
+
+        if (!restrictedInitialization && _lexicalAnalyzer->currentToken()._subClass == Token::SubClass::Equal)
+            if (identifiers.size() > 1)
+                throwException(_lexicalAnalyzer->currentToken(), "Can't initialize more than one variable");
+            else {
+                _lexicalAnalyzer->nextToken();
+                Node::PNode_t value = make<ValueNode>(parseInitialization(type));
+                declarations.back()->addChild(_nodes, value);
+                _symbols.entry(binding).second = value;
+            };
+
+        if (!isParamList) 
+            expect(Token::SubClass::Semicolon);
+        else if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Semicolon)
+            expect(Token::SubClass::RightParenthesis);
+        else {
+            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
+            goto paramListLabel;
+        }
+    } while (_lexicalAnalyzer->nextToken()._subClass == Token::SubClass::Identifier);
+    return declarations;
+};
+
+Node::PNode_t Parser::parseVarDecl(Token t) {
+    return make<Declaration>(Node::Type::VarDecl, t, parseDeclarations(Token::SubClass::Colon));
+};
+
+Node::PNode_t Parser::parseTypeDecl(Token t) {
+    Node::VecPNode_t declarations = parseDeclarations(Token::SubClass::Equal, true);
+    return make<Declaration>(Node::Type::TypeDecl, t, declarations);
+};
+
+Node::PNode_t Parser::parseProcDecl(Token t) {
+    return make<Declaration>(Node::Type::ProcDecl, t, parseProcedure());
+}
+
+Node::PNode_t Parser::parseFuncDecl(Token t) {
+    return make<Declaration>(Node::Type::FuncDecl, t, parseFunction());
+}
+
+Node::PNode_t Parser::parseConstDecl(Token t) {
+    Token next, identifier = _lexicalAnalyzer->currentToken();
+    Node::PNode_t type, value, expr;
+    Node::VecPNode_t constants;
+
+    do {
+        switch ((next = _lexicalAnalyzer->nextToken())._subClass) {
+        case Token::SubClass::Colon:
+            _lexicalAnalyzer->nextToken();
+            type = make<TypeNode>(parseType(), Node::Type::ConstIdentifier);
+            expect(Token::SubClass::Equal);
+            _lexicalAnalyzer->nextToken();
+            value = make<ValueNode>(parseInitialization(type));
+            break;
+        case Token::SubClass::Equal:
+            _lexicalAnalyzer->nextToken();
+            expr = parseConstExpr();
+            type = make<TypeNode>(defineConstType(validateAndReturnExprType(expr)), Node::Type::ConstIdentifier);
+            value = make<ValueNode>(Node::VecPNode_t({ expr }));
+            break;
+        default:
+            throwException(next, "What a terrible failure");
+            break;
+        };
+
+        expect(Token::SubClass::Semicolon);
+        checkDuplicity(identifier);
+        constants.push_back(make<ParentNode>(Node::Type::ConstIdentifier, identifier, type, value));
+        _symbols.declare(identifier.symbol(), { type, value }, identifier._offset);
+    } while ((identifier = _lexicalAnalyzer->nextToken())._subClass == Token::SubClass::Identifier);
+    return make<Declaration>(Node::Type::ConstDecl, t, constants);
+};
+
+Node::PNode_t Parser::parseConstExpr() {
+    Token t = _lexicalAnalyzer->currentToken();
+    Node::PNode_t expr = parseExpr();
+    Node::Type exprType = validateAndReturnExprType(expr);
+    if (!_reducibleScalarTypes.count(exprType))
+        throwException(t, "Scalar type expected");
+    checkIfExprIsConst(expr);
+    return expr;
+};
+
+void Parser::checkIfExprIsConst(Node::PNode_t expr) {
+    if (expr->_type == Node::Type::BinaryOperator ||
+        expr->_type == Node::Type::UnaryOperator ||
+        expr->_type == Node::Type::IntConst ||
+        expr->_type == Node::Type::FloatConst ||
+        expr->_type == Node::Type::CharConst ||
+        (resolve(expr) && resolve(expr)->first->_children.front()->_type == Node::Type::ConstIdentifier))
+        for (auto i : expr->_children)
+            checkIfExprIsConst(i);
+    else
+        throwException(expr->_token, "Const identifier or expression expected: \"" + expr->toString() + "\"");
+};
+
+// la patte
+Node::PNode_t Parser::parseFunction() {
+    _symbols.pushScope(true);
+    _typeAliases.pushScope();
+
+    Token identifier = _lexicalAnalyzer->currentToken();
+    declareRoutine(identifier);
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::LeftParenthesis);
+    _lexicalAnalyzer->nextToken();
+
+    Node::PNode_t params = make<ParameterList>(parseDeclarations(Token::SubClass::Colon, false, false, true));
+    expect(Token::SubClass::Colon);
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
+
+    Node::PNode_t type = make<TypeNode>(parseType(), Node::Type::Type, "return_type");
+    expect(Token::SubClass::Semicolon);
+    _lexicalAnalyzer->nextToken();
+
+    Node::VecPNode_t nodes = std::vector<Node::PNode_t>({ params, type });
+    if (!_skimBodies)
+        parseRoutineBody(nodes);
+    Node::PNode_t result = make<Function>(identifier, nodes, params, type);
+    if (_skimBodies)
+        skipRoutineBody(result, params);
+
+    _symbols.popScope();
+    _typeAliases.popScope();
+    _symbols.declare(identifier.symbol(), { type, result }, identifier._offset);
+    return result;
+};
+
+// la patte
+Node::PNode_t Parser::parseProcedure() {
+    _symbols.pushScope(true);
+    _typeAliases.pushScope();
+
+    Token identifier = _lexicalAnalyzer->currentToken();
+    declareRoutine(identifier);
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::LeftParenthesis);
+    _lexicalAnalyzer->nextToken(); 
+
+    Node::PNode_t params = make<ParameterList>(parseDeclarations(Token::SubClass::Colon, false, false, true));
+    expect(Token::SubClass::Semicolon);
+    _lexicalAnalyzer->nextToken();
+
+    Node::VecPNode_t nodes = std::vector<Node::PNode_t>({ params });
+    if (!_skimBodies)
+        parseRoutineBody(nodes);
+    Procedure* result = make<Procedure>(identifier, nodes, params);
+    if (_skimBodies)
+        skipRoutineBody(result, params);
+
+    _symbols.popScope();
+    _typeAliases.popScope();
+    _symbols.declare(identifier.symbol(), { nullptr, result }, identifier._offset);
+    return result;
+};
+
+// Local declarations and statements, through the semicolon after the end
+void Parser::parseRoutineBody(Node::VecPNode_t& nodes) {
+    if (_declKeywords.count(_lexicalAnalyzer->currentToken()._subClass))
+        nodes.push_back(parseDeclaration());
+
+    expect(Token::SubClass::Begin);
+    _lexicalAnalyzer->nextToken();
+    nodes.push_back(parseStatement());
+    expect(Token::SubClass::End);
+    expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
+    _lexicalAnalyzer->nextToken();
+};
+
+// Tokens of the body up to the end matching its first begin. Records in the local
+// declarations have an end of their own, the bodies of nested routines a begin and an end.
+// Nested routines get their names declared here, as parsing them in place would do.
+// A body the skim fails in is kept up to the last token read, it may have failed sooner.
+void Parser::skipRoutineBody(Node::PNode_t routine, Node::PNode_t params) {
+    Body_t body = { routine, params, _lexicalAnalyzer->currentToken()._offset, 0 };
+    size_t depth = 0, nested = 0;
+    bool inRecord = false;
+    try {
+        for (Token t = _lexicalAnalyzer->currentToken(); ; t = _lexicalAnalyzer->nextToken())
+            switch (t._subClass) {
+            case Token::SubClass::Begin:
+            case Token::SubClass::Record:
+                if (!depth++)
+                    inRecord = t._subClass == Token::SubClass::Record;
+                break;
+            case Token::SubClass::Procedure:
+            case Token::SubClass::Function:
+                if (!depth) {
+                    ++nested;
+                    declareRoutine(_lexicalAnalyzer->nextToken());
+                };
+                break;
+            case Token::SubClass::End:
+                if (!depth)
+                    expect(t, Token::SubClass::Begin);
+                if (--depth || inRecord)
+                    break;
+                if (nested) {
+                    --nested;
+                    break;
+                };
+                expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Semicolon);
+                body.end = _lexicalAnalyzer->currentToken()._offset;
+                _lexicalAnalyzer->nextToken();
+                _bodies.push_back(body);
+                return;
+            case Token::SubClass::EndOfFile:
+                expect(t, Token::SubClass::End);
+            default:
+                break;
+            };
+    }
+    catch (...) {
+        body.end = _lexicalAnalyzer->currentToken()._offset;
+        _bodies.push_back(body);
+        throw;
+    };
+};
+
+// The body is read by a lexer of its own from its first token, in a routine scope that gets
+// the parameters again. Type aliases and routines declared after the body stay hidden.
+void Parser::parseSkippedBody(const Body_t& body) {
+    PLexicalAnalyzer_t lexer = _lexicalAnalyzer;
+    _errorOffset = NoOffset;
+    _lexicalAnalyzer = lexer->resume(body.offset);
+    _lexicalAnalyzer->nextToken();
+    _symbols.pushScope(true);
+    _typeAliases.pushScope();
+    for (auto i : body.params->_children)
+        _symbols.declare(i->symbol(), { i->_children.front(), i->_children.size() > 1 ? i->_children.back() : nullptr }, i->_token._offset);
+    _typeAliases.setHorizon(body.end);
+    _routines.setHorizon(body.end);
+
+    Node::VecPNode_t nodes;
+    try {
+        parseRoutineBody(nodes);
+    }
+    catch (...) {
+        _lexicalAnalyzer = lexer;
+        throw;
+    };
+    for (auto i : nodes)
+        body.routine->addChild(_nodes, i);
+
+    _typeAliases.setHorizon(SymbolTable::NoHorizon);
+    _routines.setHorizon(SymbolTable::NoHorizon);
+    _symbols.popScope();
+    _typeAliases.popScope();
+    // string literals of the body live in the lexer's arena
+    _nodes.adopt(_lexicalAnalyzer->_arena);
+    _lexicalAnalyzer = lexer;
+};
+
+// Bodies only add to their own routine node and read what is declared outside of them, so
+// with threads to spare they are shared out in source order between workers. Each worker
+// has an arena and copies of the type aliases and routines of its own. Of the bodies that
+// fail, the one first in the source throws, as it would in the sequential loop, with its
+// offset in _errorOffset; a worker stops at its first failure, after which it could only
+// find later ones.
+void Parser::parseBodies() {
+    std::vector<Body_t> bodies;
+    std::swap(bodies, _bodies);
+    _skimBodies = false;
+    if (_threads < 2 || bodies.size() < 2) {
+        for (auto& i : bodies)
+            parseSkippedBody(i);
+        return;
+    };
+
+    std::vector<std::unique_ptr<Parser>> workers;
+    std::vector<std::exception_ptr> errors(bodies.size());
+    std::vector<uint32_t> offsets(bodies.size(), NoOffset);
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < std::min<size_t>(_threads, bodies.size()); ++i) {
+        workers.push_back(std::make_unique<Parser>());
+        Parser& worker = *workers.back();
+        worker._typeAliases = _typeAliases;
+        worker._routines = _routines;
+        worker._lexicalAnalyzer = _lexicalAnalyzer;
+        threads.emplace_back([&worker, &bodies, &errors, &offsets, &next]() {
+            for (size_t k; (k = next++) < bodies.size();)
+                try {
+                    worker.parseSkippedBody(bodies[k]);
+                }
+                catch (...) {
+                    errors[k] = std::current_exception();
+                    offsets[k] = worker._errorOffset;
+                    return;
+                };
+        });
+    };
+    for (auto& i : threads)
+        i.join();
+    for (auto& i : workers)
+        _nodes.adopt(i->_nodes);
+    for (size_t i = 0; i < errors.size(); ++i)
+        if (errors[i]) {
+            _errorOffset = offsets[i];
+            std::rethrow_exception(errors[i]);
+        };
+};
+
+// One name for one routine, whatever the scope. A body parsed by parseBodies finds its
+// nested routines already declared by buildTree.
+void Parser::declareRoutine(const Token& identifier) {
+    expect(identifier, Token::SubClass::Identifier);
+    SymbolTable::Binding_t binding = _routines.lookup(identifier.symbol());
+    if (binding == SymbolTable::NoBinding)
+        _routines.declare(identifier.symbol(), { nullptr, nullptr }, identifier._offset);
+    else if (_routines.position(binding) != identifier._offset)
+        throwException(identifier, "Duplicate identifier \"" + identifier.toString() + "\"");
+};
+
+Node::PNode_t Parser::parseType() {
+    Token t;
+    Token current = _lexicalAnalyzer->currentToken();
+    Token next = _lexicalAnalyzer->nextToken();
+    Node::Type type = defineNodeType(current);
+    Node::PNode_t left, right, result;
+    Node::VecPNode_t fields;
+    PNodePair_t* constant = nullptr;
+
+    switch (type) {
+    case Node::Type::Integer:
+    case Node::Type::Float:
+    case Node::Type::Char:
+    case Node::Type::String:
+        if (next._subClass == Token::SubClass::Subrange)
+            throwException(current, "Error in type definition");
+        return make<Node>(type, current);
+    case Node::Type::TypeAliasIdentifier:
+        return findSymbol(current.symbol(), _typeAliases)->first->_children.back();
+        //without sym table
+        //if (next._subClass != Token::SubClass::Subrange)
+        //    return make<TypeAlias>(current);
+    case Node::Type::ConstIdentifier:
+        constant = findSymbol(current.symbol());
+        expect(constant->second->_children.back()->_token, Token::SubClass::IntConst);
+    case Node::Type::IntConst:
+        left = make<Node>(type, current);
+        if (type == Node::Type::ConstIdentifier) {
+            left->addChild(_nodes, constant->first);
+            left->addChild(_nodes, constant->second);
+        };
+        expect(t = next, Token::SubClass::Subrange);
+        next = _lexicalAnalyzer->nextToken();
+        if (next._subClass == Token::SubClass::IntConst)
+            right = make<IntConst>(next);
+        else if (defineNodeType(next) == Node::Type::ConstIdentifier) {
+            right = make<Node>(Node::Type::ConstIdentifier, next);
+            constant = findSymbol(next.symbol());
+            right->addChild(_nodes, constant->first);
+            right->addChild(_nodes, constant->second);
+        }
+        //without semantics
+        //else if (next._subClass == Token::SubClass::Identifier && _identifierNodeTypes.count(next._value.s) == 0)
+        //    right = make<TypeAlias>(next);
+        else
+            throwException(next, "Error in type definition");
+        result = make<Subrange>(t, left, right);
+        _lexicalAnalyzer->nextToken();
+        break;
+    case Node::Type::Record:
+        fields = parseDeclarations(Token::SubClass::Colon, true, true);
+        result = make<Record>(current, fields);
+        _symbols.popScope();
+        expect(Token::SubClass::End);
+        _lexicalAnalyzer->nextToken();
+        break;
+    case Node::Type::Array:
+        result = make<Node>(type, current);
+        expect(next, Token::SubClass::LeftBracket);
+        _lexicalAnalyzer->nextToken();
+        result->addChild(_nodes, parseType());
+        expect(result->_children.back()->_token, Token::SubClass::Subrange);
+        expect(Token::SubClass::RightBracket);
+        expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Of);
+        _lexicalAnalyzer->nextToken();
+        result->addChild(_nodes, make<TypeNode>(parseType(), Node::Type::Type));
+        break;
+    }
+        return result;
+};
+
+Node::VecPNode_t Parser::parseInitialization(Node::PNode_t typeNode) {
+    Node::PNode_t result, type = typeNode->_children.back();
+    Node::VecPNode_t values, nodes;
+    std::map<Node::PNode_t, bool> initialized;
+    uint64_t lowerBound, upperBound;
+
+    Node::Type currentType = type->_type;
+    switch (currentType) {
+    case Node::Type::Integer:
+    case Node::Type::IntConst:
+    case Node::Type::Subrange:
+    case Node::Type::Float:
+    case Node::Type::FloatConst:
+    case Node::Type::String:
+    case Node::Type::Char:
+    case Node::Type::CharConst:
+        checkExprType(result = parseExpr(), _ordinalInitializers.at(currentType));
+        values.push_back(result);
+        break;
+    case Node::Type::Array:
+        lowerBound = dynamic_cast<Subrange*>(type->_children.front())->_lowerBound;
+        upperBound = dynamic_cast<Subrange*>(type->_children.front())->_upperBound;
+        expect(Token::SubClass::LeftParenthesis);
+        for (uint64_t i = lowerBound; i <= upperBound; ++i) {
+            _lexicalAnalyzer->nextToken();
+            for (auto j : parseInitialization(type->_children.back()))
+                nodes.push_back(j);
+            if (i < upperBound)
+                expect(Token::SubClass::Comma);
+        };
+        expect(Token::SubClass::RightParenthesis);
+        values.push_back(make<ValueNode>(nodes, "array"));
+        _lexicalAnalyzer->nextToken();
+        break;
+    case Node::Type::Record:
+        expect(Token::SubClass::LeftParenthesis);
+        for (auto i : type->_children) {
+            expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Identifier);
+            if (_lexicalAnalyzer->currentToken().symbol() == i->symbol()) {
+                expect(_lexicalAnalyzer->nextToken(), Token::SubClass::Colon);
+                _lexicalAnalyzer->nextToken();
+                values.push_back(make<ParentNode>(Node::Type::Identifier, i->_token, parseInitialization(i->_children.back())));
+                initialized.insert({i, true});
+            }
+            else {
+                for (auto j : type->_children)
+                    if (_lexicalAnalyzer->currentToken().symbol() == j->symbol())
+                        if (initialized.count(j))
+                            throwException(_lexicalAnalyzer->currentToken(), "Field has already been initialized");
+                        else if (&j != &i)
+                            throwException(_lexicalAnalyzer->currentToken(), "Incorrect initialization order");
+                throwException(_lexicalAnalyzer->currentToken(), "Unknown field");
+            };
+            expect(Token::SubClass::Semicolon);
+        };
+        expect(_lexicalAnalyzer->nextToken(), Token::SubClass::RightParenthesis);
+        _lexicalAnalyzer->nextToken();
+        break;
+    default:
+        throwException(_lexicalAnalyzer->currentToken(), "Can't initialize variable of this type");
+    }
+    return values;
+};
+
+Node::Type Parser::defineNodeType(const Token& t) {
+    if (t._subClass == Token::SubClass::Identifier) {
+        PNodePair_t* symbol = findSymbol(t.symbol());
+        PNodePair_t* alias;
+        if (!symbol && _identifierNodeTypes.count(Interner::name(t.symbol())))
+            return _identifierNodeTypes.at(Interner::name(t.symbol()));
+        //without sym table
+        //else return Node::Type::TypeAliasIdentifier;
+        else if (symbol && dynamic_cast<TypeNode*>(symbol->first)->isConst())
+            return Node::Type::ConstIdentifier;
+        else if ((alias = findSymbol(t.symbol(), _typeAliases)) &&
+                 dynamic_cast<TypeNode*>(alias->first)->isTypeAlias())
+            return Node::Type::TypeAliasIdentifier;
+    };
+    if (_subClassNodeTypes.count(t._subClass))
+        return _subClassNodeTypes.at(t._subClass);
+    throwException(t, "Error in type definition");
+};
+
+Node::PNode_t Parser::defineConstType(Node::Type type) {
+    switch (type) {
+    case Node::Type::Float:
+        return make<NamedNode>(Node::Type::FloatConst, "real");
+    case Node::Type::Char:
+        //return t.toString().length() > 1 ?
+            //make<NamedNode>(Node::Type::StringLiteral, "string") :
+            make<NamedNode>(Node::Type::CharConst, "char");
+    case Node::Type::Integer:
+        return make<NamedNode>(Node::Type::IntConst, "integer");
+    default:
+        break;
+    }
+};
+
+Node::PNode_t Parser::defineConstType(const Token& t) {
+    switch (t.vtype()) {
+    case Token::ValueType::Double:
+        return make<NamedNode>(Node::Type::FloatConst, "real");
+    case Token::ValueType::String:
+        return t.toString().length() > 1 ?
+               make<NamedNode>(Node::Type::StringLiteral, "string") :
+               make<NamedNode>(Node::Type::CharConst, "char");
+    case Token::ValueType::ULL:
+        return make<NamedNode>(Node::Type::IntConst, "integer");
+    default:
+        throwException(t, "Error in const definition");
+    }
+};
+
+Parser::PNodePair_t* Parser::findSymbol(Interner::Symbol_t symbol) {
+    return _symbols.find(symbol);
+};
+
+Parser::PNodePair_t* Parser::findSymbol(Interner::Symbol_t symbol, SymbolTable& table) {
+    return table.find(symbol);
+};
+
+// An expression is checked where it's parsed, in the scope it was resolved in, so the
+// binding kept on the node stays the right one. A name that isn't found is looked up again.
+Parser::PNodePair_t* Parser::resolve(Node::PNode_t node) {
+    SymbolTable::Binding_t* binding = node->binding();
+    if (!binding)
+        return findSymbol(node->symbol());
+    if (*binding == SymbolTable::NoBinding && (*binding = _symbols.lookup(node->symbol())) == SymbolTable::NoBinding)
+        return nullptr;
+    return &_symbols.entry(*binding);
+};
+
+Node::PNode_t Parser::parseScalarIdentifier() {
+    expect(Token::SubClass::Identifier);
+    Node::PNode_t node = make<Identifier>(_lexicalAnalyzer->currentToken());
+    _lexicalAnalyzer->nextToken();
+    return node;
+};
+
+Node::VecPNode_t Parser::parseIdentifierList() {
+    Node::VecPNode_t identifiers;
+    do {
+        identifiers.push_back(parseScalarIdentifier());
+        if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Comma)
+            break;
+        _lexicalAnalyzer->nextToken();
+    } while (true);
+    return identifiers;
+};
+
+// Precedence climbing: the right operand takes the operators binding tighter than the one
+// just read (or as tight, if it's right associative), the loop the rest
+Node::PNode_t Parser::parseExpr(unsigned char minPower) {
+    Node::PNode_t left = parseFactor();
+    Token t = _lexicalAnalyzer->currentToken();
+    for (const Operator_t* op = &findOperator(t._subClass); op->power > minPower; op = &findOperator(t._subClass)) {
+        _lexicalAnalyzer->nextToken();
+        left = make<BinaryOperator>(t, left, parseExpr(op->rightAssociative ? static_cast<unsigned char>(op->power - 1) : op->power));
+        t = _lexicalAnalyzer->currentToken();
+    }
+    return left;
+};
+
+Node::PNode_t Parser::parseFactor() {
+    Node::PNode_t e;
+    Token t = _lexicalAnalyzer->currentToken();
+    _lexicalAnalyzer->nextToken();
+    if (findOperator(t._subClass).prefix)
+        return make<UnaryOperator>(t, parseExpr());
+    switch (t._subClass) {
+    case Token::SubClass::Identifier:
+        return parseIdentifier(t);
+        break;
+    case Token::SubClass::IntConst:
+        return make<IntConst>(t);
+        break;
+    case Token::SubClass::FloatConst:
+        return make<FloatConst>(t);
+        break;
+    case Token::SubClass::StringLiteral:
+        if (t._length == 3)
+            return make<CharConst>(t);
+        else
+            return make<StringLiteral>(t);        
+        break;
+    case Token::SubClass::LeftParenthesis:
+        e = parseExpr();
+        expect(Token::SubClass::RightParenthesis);
+        _lexicalAnalyzer->nextToken();
+        return e;
+        break;
+    case Token::SubClass::For:
+    case Token::SubClass::To:
+    case Token::SubClass::DownTo:
+    case Token::SubClass::Do:
+    case Token::SubClass::If:
+    case Token::SubClass::Then:
+    case Token::SubClass::Else:
+        return make<ReservedWord>(t);
+        break;
+    case Token::SubClass::EndOfFile:
+        throwException(t, "Unexpected end of file");
+        break;
+    default:
+        throwException(t, "Illegal expression");
+        break;
+    }
+};
+
+Node::PNode_t Parser::parseIdentifier(Token t) {
+    Node::VecPNode_t args;
+    Node::PNode_t identifier = make<Identifier>(t);
+    std::set<Token::SubClass> allowed = { 
+        Token::SubClass::Dot, 
+        Token::SubClass::LeftBracket, 
+        Token::SubClass::LeftParenthesis 
+    };
+    while (allowed.count(_lexicalAnalyzer->currentToken()._subClass)) {
+        Token t = _lexicalAnalyzer->currentToken();
+        _lexicalAnalyzer->nextToken();
+        switch (t._subClass) {
+            case Token::SubClass::Dot:
+                identifier = make<RecordAccess>(identifier, parseScalarIdentifier());
+                break;
+            case Token::SubClass::LeftBracket:
+                identifier = make<ArrayIndex>(identifier, parseExpr());
+                expect(Token::SubClass::RightBracket);
+                _lexicalAnalyzer->nextToken();
+                break;
+            case Token::SubClass::LeftParenthesis:
+                if (identifier->_type != Node::Type::Identifier)
+                    throwException(t, "Illegal function call");
+                identifier = make<FunctionCall>(identifier, parseArgs());
+                expect(Token::SubClass::RightParenthesis);
+                _lexicalAnalyzer->nextToken();
+                break;
+            default:
+                break;
+        }
+    }
+    return identifier;
+};
+
+Node::VecPNode_t Parser::parseArgs() {
+    Node::VecPNode_t args; 
+    if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::RightParenthesis)
+        do {
+            args.push_back(parseExpr());
+            if (_lexicalAnalyzer->currentToken()._subClass != Token::SubClass::Comma)
+                break;
+            _lexicalAnalyzer->nextToken();
+        } while (true);
+    return args;
+};
+
+void Parser::buildTree(bool skimBodies) {
+    _root = nullptr;
+    _nodes.clear();
+    _bodies.clear();
+    _skimBodies = skimBodies;
+    _errorOffset = NoOffset;
+    try {
+        _root = parseProgram();
+    }
+    catch (...) {
+        if (!skimBodies)
+            throw;
+        // A body that fails at the skim's error or before it would have failed first in place
+        std::exception_ptr error = std::current_exception();
+        uint32_t offset = _errorOffset;
+        while (!_bodies.empty() && _bodies.back().offset >= offset)
+            _bodies.pop_back();
+        try {
+            parseBodies();
+        }
+        catch (...) {
+            if (_errorOffset <= offset)
+                throw;
+        };
+        std::rethrow_exception(error);
+    };
+    int offset;
+    //for (auto i : *_symTables.get())
+    //    for (auto j : *i.get()) {
+    //        if (!dynamic_cast<TypeNode*>(j.second.first)->isTypeAlias()) {
+    //            offset = AsmCode::getTypeSize(j.second.first->_children.front());
+    //            AsmCode::_offset += offset;
+    //            AsmCode::_offsetMap[j.first] = { offset, AsmCode::_offset };
+    //        }
+    //    };
+    //AsmCode::PAsmCommand setOffset = std::make_shared<AsmCommand>(AsmCommands::Enter, std::vector<std::string>({ std::to_string(AsmCode::_offset), "1" }));
+    //AsmCode::addCommand(setOffset);
+    //AsmCode::generateStatements(_root->_children.back());
+    //AsmCode::generate(std::ofstream("code.asm"));
+};
+
+template<typename T>
+void Parser::open(T filename) {
+    _lexicalAnalyzer = std::make_shared<LexicalAnalyzer>(filename);
+};
+
+void Parser::visualizeTree(std::wostream& os, Node::PNode_t node, bool isLastChild = true,
+                           std::vector<std::pair<int, bool>> margins = std::vector<std::pair<int, bool>>(0)) {
+    for (auto i : margins) {
+        if (i.second)
+            os << L'│';
+        for (auto j = 0; j < (i.first - i.second) - 1; ++j)
+            os << " ";
+    };
+    os << (isLastChild ? L'└' : L'├') << L'─' << node->toString().c_str() << std::endl;
+
+    for (auto i : node->_children) {
+        margins.push_back({ node->toString().length() + 2, !isLastChild });
+        visualizeTree(os, i, i == node->_children.back(), margins);
+        margins.pop_back();
+    };
+};
+
+FlatTree Parser::flatten() {
+    parseBodies();
+    FlatTree tree(_root);
+    // the symbol tables point at the nodes too
+    _root = nullptr;
+    _symbols.clear();
+    _typeAliases.clear();
+    _nodes.clear();
+    return tree;
+};
+
+// With more than one thread the bodies are skimmed and parsed side by side afterwards; the
+// error reported is still the first one in the source
+void Parser::log(std::wostream& os, bool flat) {
+    try {
+        buildTree(_threads > 1);
+        parseBodies();
+    }
+    catch (std::exception e) {
+        os << e.what();
+        return;
+    }
+    if (flat)
+        flatten().log(os);
+    else
+        visualizeTree(os, _root);
+};
+
+void Parser::outline(std::wostream& os) {
+    try {
+        buildTree(true);
+    }
+    catch (std::exception e) {
+        os << e.what();
+        return;
+    }
+    visualizeTree(os, _root);
+};
+
+void Parser::expect(Token::SubClass expected) {
+    expect(_lexicalAnalyzer->currentToken(), expected);
+};
+
+void Parser::expect(const Token& t, Token::SubClass expected) {
+    std::stringstream ss;
+    if (expected != t._subClass) {
+        if (t._subClass == Token::SubClass::EndOfFile)
+            throwException(t, "Unexpected end of file");
+        else {
+            ss << "Syntax error, \""
+                << _lexicalAnalyzer->_subClassDict.at(expected)
+                << "\" expected, but \""
+                << _lexicalAnalyzer->_subClassDict.at(t._subClass)
+                << "\" found";
+            throwException(t, ss.str());
+        }
+    }
+};
+
+void Parser::expect(const Token& t, Node::Type received, Node::Type expected) {
+    std::stringstream ss;
+    if (received != expected) {
+        ss << "Incompatible types: \""
+           << _nodeTypes.at(expected)
+           << "\" expected, but \""
+           << _nodeTypes.at(received)
+           << "\" found";
+        throwException(t, ss.str());
+    }
+};
+
+void Parser::checkExprType(Node::PNode_t expr, Node::Type type) {
+    if (expr->_children.size()) {
+        for (auto i : expr->_children)
+            checkExprType(i, type);
+        return;
+    };
+    expect(expr->_token, expr->_type, type);
+};
+
+void Parser::checkExpr(Node::PNode_t expr) {
+    if (expr->_type == Node::Type::Identifier)
+        checkIdentifier(expr);
+    
+    for (auto i : expr->_children)
+        checkExpr(i);
+};
+
+void Parser::checkIdentifier(Node::PNode_t identifier) {
+    PNodePair_t* symbol;
+    if (identifier->symbol() != _writeSymbol && identifier->symbol() != _writelnSymbol)
+        if (!(symbol = resolve(identifier)))
+            throwException(identifier->_token, "Identifier not found: \"" + identifier->toString() + "\"");
+        else if (_routines.lookup(identifier->symbol()) == SymbolTable::NoBinding) {
+            if (dynamic_cast<TypeNode*>(symbol->first)->isConst())
+                throwException(identifier->_token, "Can't modify constant values: \"" + identifier->toString() + "\"");
+            else if (dynamic_cast<TypeNode*>(symbol->first)->isTypeAlias())
+                throwException(identifier->_token, "Can't modify type aliases: \"" + identifier->toString() + "\"");
+        };
+};
+
+Node::Type Parser::annotate(Node::PNode_t expr) {
+    if (expr->_exprType == Node::Type::Unresolved)
+        expr->_exprType = validateAndReturnExprType(expr);
+    return expr->_exprType;
+};
+
+// Reached through annotate only: operands are annotated first, so none is typed twice
+Node::Type Parser::validateAndReturnExprType(Node::PNode_t expr) {
+    if (expr->_type == Node::Type::BinaryOperator) {
+        Node::PNode_t left = expr->_children.front();
+        Node::PNode_t right = expr->_children.back();
+        Node::Type leftType = annotate(left);
+        Node::Type rightType = annotate(right);
+        if (leftType == Node::Type::Char || rightType == Node::Type::Char)
+            throwException(expr->_token, "Can't apply operator \"" + expr->toString() + "\" to char");
+        if (leftType == Node::Type::Array || rightType == Node::Type::Array)
+            throwException(expr->_token, "Can't apply operator \"" + expr->toString() + "\" to array");
+        if (leftType == Node::Type::Record || rightType == Node::Type::Record)
+            throwException(expr->_token, "Can't apply operator \"" + expr->toString() + "\" to record");
+        if (leftType == Node::Type::FunctionCall || rightType == Node::Type::FunctionCall)
+            throwException(expr->_token, "Can't use procedures in expressions");
+        if (expr->_token._subClass == Token::SubClass::Add ||
+            expr->_token._subClass == Token::SubClass::Sub ||
+            expr->_token._subClass == Token::SubClass::Mult) {
+            if (leftType == rightType)
+                return leftType;
+            else if ((leftType == Node::Type::Integer && rightType == Node::Type::Float) ||
+                (leftType == Node::Type::Float && rightType == Node::Type::Integer))
+                return Node::Type::Float;
+        }
+        else if (expr->_token._subClass == Token::SubClass::SHL ||
+            expr->_token._subClass == Token::SubClass::SHR ||
+            expr->_token._subClass == Token::SubClass::And ||
+            expr->_token._subClass == Token::SubClass::Or ||
+            expr->_token._subClass == Token::SubClass::Mod ||
+            expr->_token._subClass == Token::SubClass::Div) {
+            if ((leftType == Node::Type::Float) || (rightType == Node::Type::Integer) ||
+                (leftType == Node::Type::Char) || (rightType == Node::Type::Char))
+                throwException(expr->_token, "Can't apply operator \"" + expr->toString() + "\" to other than integers");
+            else if (expr->_token._subClass == Token::SubClass::Div)
+                return Node::Type::Float;
+            else
+                return Node::Type::Integer;
+        }
+        else if (expr->_token._subClass == Token::SubClass::Equal ||
+                 expr->_token._subClass == Token::SubClass::Less ||
+                 expr->_token._subClass == Token::SubClass::More ||
+                 expr->_token._subClass == Token::SubClass::LEQ ||
+                 expr->_token._subClass == Token::SubClass::MEQ ||
+                 expr->_token._subClass == Token::SubClass::NEQ) 
+            if (leftType == Node::Type::Char || rightType == Node::Type::Char)
+                throwException(expr->_token, "Can't apply operator \"" + expr->toString() + "\" to chars");
+            else
+                return Node::Type::Integer;
+    }
+    else if (expr->_type == Node::Type::UnaryOperator)
+        return annotate(expr->_children.front());
+    else if (expr->_type == Node::Type::FunctionCall) {
+        // arguments aren't typed against the parameters, only their names are checked
+        for (auto i : expr->_children)
+            checkExpr(i);
+        PNodePair_t* routine = resolve(expr->_children.front());
+        if (!routine)
+            throwException(expr->_children.front()->_token, "Identifier not found: \"" + expr->_children.front()->toString() + "\"");
+        else if (_routines.lookup(expr->_children.front()->symbol()) == SymbolTable::NoBinding)
+            throwException(expr->_children.front()->_token, "Identifier's not a function or a procedure: \"" + expr->_children.front()->toString() + "\"");
+        if (routine->first) {
+            Function* f = static_cast<Function*>(routine->second);
+            Node::VecPNode_t params = static_cast<ParameterList*>(f->_paramList)->getParams();
+            if (params.size() != expr->_children.size() - 1)
+                throwException(expr->_children.front()->_token, "Wrong amount of arguments in function call \"" + expr->_children.front()->toString() + "\"");
+            //for (size_t i = 1; i < expr->_children.size(); ++i) {
+            //    if (findSymbol(expr->_children[i]->toString())) /////////// validate
+            //        validateNodeTypes(params[i - 1], findSymbol(expr->_children[i]->toString())->first->_children.front(), expr->_children[i]->_token);
+            //    else
+            //        validateNodeTypes(params[i - 1], expr->_children[i], expr->_children[i]->_token);
+            //}
+            return routine->first->_children.front()->_type;
+        }
+        else
+            return Node::Type::FunctionCall;
+    }
+    else if (expr->_type == Node::Type::Identifier) {
+        checkIdentifier(expr);
+        if (_routines.lookup(expr->symbol()) != SymbolTable::NoBinding)
+            throwException(expr->_token, "Improper call of a function or a procedure: \"" + expr->toString() + "\"");
+        return resolve(expr)->first->_children.front()->_type;
+    }
+    else if (expr->_type == Node::Type::IntConst)
+        return Node::Type::Integer;
+    else if (expr->_type == Node::Type::FloatConst)
+        return Node::Type::Float;
+    else if (expr->_type == Node::Type::CharConst)
+        return Node::Type::Char;
+    else {
+        for (auto i : expr->_children)
+            checkExpr(i);
+        return expr->_type;
+    };
+};
+
+void Parser::validateNodeTypes(Node::PNode_t leftTypeNode, Node::PNode_t rightTypeNode, const Token& t) {
+    if (leftTypeNode->_type == rightTypeNode->_type) {
+        if (leftTypeNode->_type == Node::Type::Subrange)
+            if ((static_cast<Subrange*>(leftTypeNode)->_lowerBound != 
+                static_cast<Subrange*>(rightTypeNode)->_lowerBound) ||
+                (static_cast<Subrange*>(leftTypeNode)->_upperBound !=
+                 static_cast<Subrange*>(rightTypeNode)->_upperBound))
+            throwException(t, "Incompatible types");
+        if (leftTypeNode->_children.size() == rightTypeNode->_children.size())
+            for (size_t i = 0; i < leftTypeNode->_children.size(); ++i)
+                validateNodeTypes(leftTypeNode->_children[i], rightTypeNode->_children[i], t);
+        else
+            throwException(t, "Incompatible types");
+    }
+    else
+        throwException(t, "Incompatible types");
+};
+
+void Parser::validateAssignment(Node::PNode_t left, Node::PNode_t right) {
+    Node::Type leftType = annotate(left);
+    Node::Type rightType = annotate(right);
+    if ((_reducibleScalarTypes.count(leftType) && !_reducibleScalarTypes.count(rightType)) ||
+        (!_reducibleScalarTypes.count(leftType) && _reducibleScalarTypes.count(rightType)))
+        throwException(right->_token, "Can't assign operand of this type");
+    else if (!_reducibleScalarTypes.count(leftType) && !_reducibleScalarTypes.count(rightType))
+        validateNodeTypes(resolve(left)->first, resolve(right)->first, right->_token);
+};
+
+void Parser::checkDuplicity(const Token& t, bool isLocal) {
+    if (isLocal ? _symbols.declaresLocally(t.symbol()) : findSymbol(t.symbol()) != nullptr)
+        throwException(t, "Duplicate identifier \"" + t.toString() + "\"");
+};
+
+void Parser::throwException(const Token& t, std::string msg) {
+    _errorOffset = t._offset;
+    Token::Position_t pos = _lexicalAnalyzer->position(t);
+    std::stringstream ss;
+    ss << "(" << pos.first << ", " << pos.second << "): " << msg.c_str();
+    throw std::exception(ss.str().c_str());
 };
\ No newline at end of file
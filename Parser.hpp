@@ -1,103 +1,155 @@
-#pragma once
-#include "LexicalAnalyzer.hpp"
-#include "Node.hpp"
-#include "AsmCode.hpp"
-#include <set>
-#include <vector>
-
-class Parser {
-
-    typedef Node::PNode_t (Parser::*PNodeFunction_t)(void);
-    typedef std::set<Node::Type> ScalarTypesDict_t;
-    typedef std::map<Node::Type, std::string> NodeTypesDict_t;
-    typedef std::map<std::string, Node::Type> IdentifierTypeDict_t;
-    typedef std::map<Token::SubClass, Node::Type> SubClassTypeDict_t;
-    typedef std::map<Token::SubClass, PNodeFunction_t> FunctionDict_t;
-    typedef std::map<Node::Type, Node::Type> OrdinalInitializersDict_t;
-    typedef std::set<Token::SubClass> DeclarationsKeywordsSet_t;
-    typedef std::shared_ptr<LexicalAnalyzer> PLexicalAnalyzer_t;
-    typedef std::vector<Node::PSymTable_t> VecPSymTable_t;
-    typedef std::shared_ptr<std::vector<Node::PSymTable_t>> PVecPSymTable_t;
-    typedef std::pair<Node::PNode_t, Node::PNode_t> PNodePair_t;
-
-    enum class Precedence {
-        First,
-        Second,
-        Third,
-        Last,
-    };
-
-    public:
-        Parser() {};
-        Parser(const char* filename);
-        ~Parser() {};
-
-        void buildTree();
-
-        template<typename T>
-        void open(T filename);
-        void log(std::wostream& os);
-
-    private:
-        void visualizeTree(std::wostream& os, Node::PNode_t node, bool isLastChild, std::vector<std::pair<int, bool>> margins);
-
-        Node::PNode_t parseProgram();
-        Node::PNode_t parseProcedure();
-        Node::PNode_t parseFunction();
-        Node::PNode_t parseProgramHeading();
-        Node::PNode_t parseDeclaration();
-        Node::PNode_t parseStatement();
-
-        Node::PNode_t parseVarDecl(Token t);
-        Node::PNode_t parseTypeDecl(Token t);
-        Node::PNode_t parseProcDecl(Token t);
-        Node::PNode_t parseFuncDecl(Token t);
-        Node::PNode_t parseConstDecl(Token t);
-        
-        Node::PNode_t parseType();
-        Node::VecPNode_t parseInitialization(Node::PNode_t type);
-
-        Node::PNode_t parseBinOp(Precedence p, PNodeFunction_t pf);
-        Node::PNode_t parseExpr();
-        Node::PNode_t parseSimpleExpr();
-        Node::PNode_t parseTerm();
-        Node::PNode_t parseFactor();
-        Node::PNode_t parseConstExpr();
-        Node::PNode_t parseIdentifier(Token t);
-        Node::PNode_t parseScalarIdentifier();
-        Node::VecPNode_t parseArgs();
-        Node::VecPNode_t parseIdentifierList();
-        Node::VecPNode_t parseDeclarations(Token::SubClass separator, bool restrictedInitialization = false, bool isLocal = false, bool isParamList = false);
-
-        void throwException(Token::Position_t pos, std::string msg);
-        void expect(Token::SubClass expected);
-        void expect(Token t, Token::SubClass expected);
-        void expect(Token t, Node::Type received, Node::Type expected);
-        bool checkPrecedence(Precedence p, Token::SubClass s);
-        void checkExpr(Node::PNode_t expr);
-        void checkExprType(Node::PNode_t expr, Node::Type type);
-        void checkIfExprIsConst(Node::PNode_t expr);
-        void checkDuplicity(Token t);
-        void checkDuplicity(Token t, Node::PSymTable_t symTable);
-        void validateAssignment(Node::PNode_t left, Node::PNode_t right);
-        void validateNodeTypes(Node::PNode_t leftTypeNode, Node::PNode_t rightTypeNode, const Token::Position_t pos);
-        Node::Type defineNodeType(Token t);
-        Node::PNode_t defineConstType(Token t);
-        Node::PNode_t defineConstType(Node::Type type);
-        Node::Type validateAndReturnExprType(Node::PNode_t expr);
-        PNodePair_t* findSymbol(std::string name);
-        PNodePair_t* findSymbol(std::string name, Node::PSymTable_t symTable);
-
-        Node::PNode_t _root;
-        PVecPSymTable_t _symTables;
-        Node::PSymTable_t _typeAliases;
-        PLexicalAnalyzer_t _lexicalAnalyzer;
-        std::shared_ptr<std::set<std::string>> _funcIdentifiersTable;
-        static const ScalarTypesDict_t _reducibleScalarTypes;
-        static const NodeTypesDict_t _nodeTypes;
-        static const SubClassTypeDict_t _subClassNodeTypes;
-        static const IdentifierTypeDict_t _identifierNodeTypes;
-        static const OrdinalInitializersDict_t _ordinalInitializers;
-        static const DeclarationsKeywordsSet_t _declKeywords;
-        static const std::vector<std::set<Token::SubClass>> _precedences;
+#pragma once
+#include "LexicalAnalyzer.hpp"
+#include "Node.hpp"
+#include "AsmCode.hpp"
+#include <array>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+class Parser {
+
+    typedef std::set<Node::Type> ScalarTypesDict_t;
+    typedef std::map<Node::Type, std::string> NodeTypesDict_t;
+    typedef std::map<std::string_view, Node::Type> IdentifierTypeDict_t;
+    typedef std::map<Token::SubClass, Node::Type> SubClassTypeDict_t;
+    typedef std::map<Node::Type, Node::Type> OrdinalInitializersDict_t;
+    typedef std::set<Token::SubClass> DeclarationsKeywordsSet_t;
+    typedef std::shared_ptr<LexicalAnalyzer> PLexicalAnalyzer_t;
+    typedef SymbolTable::Entry_t PNodePair_t;
+
+    // How a token acts in an expression. power is how tightly it binds as a binary operator,
+    // 0 if it isn't one; a prefix operator applies to the whole expression after it.
+    struct Operator_t {
+        unsigned char power;
+        bool rightAssociative;
+        bool prefix;
+    };
+    typedef std::array<Operator_t, static_cast<size_t>(Token::SubClass::EndOfFile) + 1> OperatorTable_t;
+
+    // A routine body buildTree skimmed: its tokens from offset up to the semicolon at end, the
+    // routine its nodes go to and the parameters they see
+    struct Body_t {
+        Node::PNode_t routine;
+        Node::PNode_t params;
+        uint32_t offset;
+        uint32_t end;
+    };
+
+    public:
+        Parser();
+        Parser(const char* filename);
+        ~Parser() {};
+
+        // With skimBodies set, routine bodies are only scanned for the end that closes them:
+        // the tree gets the declarations and the routine signatures, parseBodies() the rest.
+        // Should the skim fail, the bodies before the error are parsed, and whichever error
+        // comes first in the source is thrown, as it would be without skimming.
+        void buildTree(bool skimBodies = false);
+        // Parses the bodies the last buildTree skimmed, each seeing what it would have seen
+        // if parsed in place
+        void parseBodies();
+        // Packs the tree of the last buildTree into a FlatTree and frees the nodes. The
+        // tokens of the result still point into this parser's source.
+        FlatTree flatten();
+
+        template<typename T>
+        void open(T filename);
+        // The tree as -ast shows it, printed from its flat form if flat is set
+        void log(std::wostream& os, bool flat = false);
+        // The declarations and routine signatures only, as -outline shows them
+        void outline(std::wostream& os);
+        // parseBodies shares the bodies out between this many threads, and log skims them then
+        static void setThreads(unsigned threads) { _threads = threads; };
+
+    private:
+        template<typename T, typename... Args>
+        T* make(Args&&... args);
+        void visualizeTree(std::wostream& os, Node::PNode_t node, bool isLastChild, std::vector<std::pair<int, bool>> margins);
+
+        Node::PNode_t parseProgram();
+        Node::PNode_t parseProcedure();
+        Node::PNode_t parseFunction();
+        Node::PNode_t parseProgramHeading();
+        Node::PNode_t parseDeclaration();
+        Node::PNode_t parseStatement();
+        void parseRoutineBody(Node::VecPNode_t& nodes);
+        void skipRoutineBody(Node::PNode_t routine, Node::PNode_t params);
+        void parseSkippedBody(const Body_t& body);
+        void declareRoutine(const Token& identifier);
+
+        Node::PNode_t parseVarDecl(Token t);
+        Node::PNode_t parseTypeDecl(Token t);
+        Node::PNode_t parseProcDecl(Token t);
+        Node::PNode_t parseFuncDecl(Token t);
+        Node::PNode_t parseConstDecl(Token t);
+        
+        Node::PNode_t parseType();
+        Node::VecPNode_t parseInitialization(Node::PNode_t type);
+
+        // Operators binding tighter than minPower, all of them by default
+        Node::PNode_t parseExpr(unsigned char minPower = 0);
+        Node::PNode_t parseFactor();
+        Node::PNode_t parseConstExpr();
+        Node::PNode_t parseIdentifier(Token t);
+        Node::PNode_t parseScalarIdentifier();
+        Node::VecPNode_t parseArgs();
+        Node::VecPNode_t parseIdentifierList();
+        Node::VecPNode_t parseDeclarations(Token::SubClass separator, bool restrictedInitialization = false, bool isLocal = false, bool isParamList = false);
+
+        void throwException(const Token& t, std::string msg);
+        void expect(Token::SubClass expected);
+        void expect(const Token& t, Token::SubClass expected);
+        void expect(const Token& t, Node::Type received, Node::Type expected);
+        void checkExpr(Node::PNode_t expr);
+        // The checks checkExpr makes on each name
+        void checkIdentifier(Node::PNode_t identifier);
+        void checkExprType(Node::PNode_t expr, Node::Type type);
+        void checkIfExprIsConst(Node::PNode_t expr);
+        // Against every visible name, or only those of the innermost scope if isLocal is set
+        void checkDuplicity(const Token& t, bool isLocal = false);
+        void validateAssignment(Node::PNode_t left, Node::PNode_t right);
+        void validateNodeTypes(Node::PNode_t leftTypeNode, Node::PNode_t rightTypeNode, const Token& t);
+        Node::Type defineNodeType(const Token& t);
+        Node::PNode_t defineConstType(const Token& t);
+        Node::PNode_t defineConstType(Node::Type type);
+        Node::Type validateAndReturnExprType(Node::PNode_t expr);
+        // The semantic pass over an expression: checks its names as checkExpr does and types
+        // it, each node once. Every node keeps its type and every name its binding, so asking
+        // again for an annotated node costs nothing.
+        Node::Type annotate(Node::PNode_t expr);
+        PNodePair_t* findSymbol(Interner::Symbol_t symbol);
+        PNodePair_t* findSymbol(Interner::Symbol_t symbol, SymbolTable& table);
+        // findSymbol for a name in an expression, looked up once and then kept on the node
+        PNodePair_t* resolve(Node::PNode_t node);
+
+        // Every node of the tree, freed together with the parser or by the next buildTree
+        Arena _nodes;
+        Node::PNode_t _root;
+        // Scopes: the program, each routine (opaque, globals aren't visible in it) and each record
+        SymbolTable _symbols;
+        // Aliases visible in routines too, those declared in one end with it
+        SymbolTable _typeAliases;
+        // Every routine name, nested ones included, in a single scope
+        SymbolTable _routines;
+        bool _skimBodies;
+        std::vector<Body_t> _bodies;
+        // Where in the source the error last thrown by throwException is, NoOffset after a
+        // lexical error: that is past every token read so far
+        uint32_t _errorOffset;
+        PLexicalAnalyzer_t _lexicalAnalyzer;
+        Interner::Symbol_t _writeSymbol;
+        Interner::Symbol_t _writelnSymbol;
+        static const ScalarTypesDict_t _reducibleScalarTypes;
+        static const NodeTypesDict_t _nodeTypes;
+        static const SubClassTypeDict_t _subClassNodeTypes;
+        static const IdentifierTypeDict_t _identifierNodeTypes;
+        static const OrdinalInitializersDict_t _ordinalInitializers;
+        static const DeclarationsKeywordsSet_t _declKeywords;
+        static unsigned _threads;
+        static const uint32_t NoOffset = 0xFFFFFFFF;
+        static const OperatorTable_t _operators;
+        static constexpr OperatorTable_t buildOperators();
+        static const Operator_t& findOperator(Token::SubClass s) { return _operators[static_cast<size_t>(s)]; };
+        friend class Benchmark;
 };
\ No newline at end of file
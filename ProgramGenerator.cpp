@@ -0,0 +1,353 @@
+#include "ProgramGenerator.hpp"
+#include <algorithm>
+
+const ProgramGenerator::Options_t ProgramGenerator::Defaults = { 1 << 20, 4, 16, 1, ProgramGenerator::Mix::Balanced };
+
+const char* const ProgramGenerator::_mixNames[] = { "balanced", "lexer", "symbols", "expressions", "codegen" };
+
+ProgramGenerator::ProgramGenerator(const Options_t& options) : _options(options), _os(nullptr), _written(0) {
+    _options.depth = std::max(1u, _options.depth);
+    _options.identifiers = std::max(1u, _options.identifiers);
+};
+
+bool ProgramGenerator::findMix(const std::string& name, Mix& mix) {
+    for (size_t i = 0; i < sizeof(_mixNames) / sizeof(*_mixNames); ++i)
+        if (name == _mixNames[i]) {
+            mix = static_cast<Mix>(i);
+            return true;
+        };
+    return false;
+};
+
+const char* ProgramGenerator::mixName(Mix mix) {
+    return _mixNames[static_cast<size_t>(mix)];
+};
+
+// The lexer mix spells every identifier out, the others keep them short
+std::string ProgramGenerator::name(const char* kind, size_t k) const {
+    if (_options.mix == Mix::Lexer)
+        return std::string(kind) + "_generated_identifier_" + std::to_string(k);
+    return kind + std::to_string(k);
+};
+
+void ProgramGenerator::emit(const std::string& text) {
+    _out += text;
+    _written += text.size();
+    if (_out.size() >= FlushSize) {
+        *_os << _out;
+        _out.clear();
+    };
+};
+
+std::string ProgramGenerator::intLiteral() {
+    unsigned value = pick(1000);
+    if (_options.mix != Mix::Lexer)
+        return std::to_string(value);
+    std::string digits;
+    switch (pick(4)) {
+    case 0:
+        for (unsigned v = value; digits.empty() || v; v >>= 1)
+            digits.insert(digits.begin(), static_cast<char>('0' + (v & 1)));
+        return "%" + digits;
+    case 1:
+        for (unsigned v = value; digits.empty() || v; v >>= 3)
+            digits.insert(digits.begin(), static_cast<char>('0' + (v & 7)));
+        return "&" + digits;
+    case 2:
+        for (unsigned v = value; digits.empty() || v; v >>= 4)
+            digits.insert(digits.begin(), "0123456789abcdef"[v & 15]);
+        return "$" + digits;
+    default:
+        return std::to_string(value);
+    }
+};
+
+std::string ProgramGenerator::realLiteral() {
+    std::string literal = std::to_string(pick(100)) + "." + std::to_string(pick(100));
+    if (_options.mix == Mix::Lexer && chance(50))
+        literal += (chance(50) ? "e-" : "e") + std::to_string(pick(20));
+    return literal;
+};
+
+std::string ProgramGenerator::stringLiteral() {
+    static const char* const words[] = { "done", "value", "it''s", "result", "caf\xC3\xA9", "\xD0\xB8\xD1\x82\xD0\xBE\xD0\xB3" };
+    std::string literal = std::string("'") + words[pick(_options.mix == Mix::Lexer ? 6 : 2)] + "'";
+    if (_options.mix == Mix::Lexer && chance(30))
+        literal += "#13#10";
+    return literal;
+};
+
+// Both block comment kinds share their DFA states, so neither may hold the other's closer
+std::string ProgramGenerator::comment() {
+    switch (pick(3)) {
+    case 0:
+        return "{ block " + std::to_string(pick(10000)) + " \xE2\x80\x94 'quoted' (* }";
+    case 1:
+        return "(* step " + std::to_string(pick(10000)) + ", { * ) *)";
+    default:
+        return "// line " + std::to_string(pick(10000)) + " \xC2\xB7 { (* } *)";
+    }
+};
+
+std::string ProgramGenerator::operand(const Scope_t& scope, bool real) {
+    unsigned choice = pick(real ? 4 : 2);
+    if (choice == 0 && !scope.integers.empty())
+        return scope.integers[pick(static_cast<unsigned>(scope.integers.size()))];
+    if (choice == 2 && !scope.reals.empty())
+        return scope.reals[pick(static_cast<unsigned>(scope.reals.size()))];
+    return choice == 3 ? realLiteral() : intLiteral();
+};
+
+// A function call, only in the program body: routines can't see each other
+std::string ProgramGenerator::call(const Scope_t& scope) {
+    if (_functions.empty())
+        return operand(scope, false);
+    const Routine_t& f = _routines[_functions[pick(static_cast<unsigned>(_functions.size()))]];
+    std::string text = f.name + "(";
+    for (size_t i = 0; i < f.realParams.size(); ++i)
+        text += (i ? ", " : "") + operand(scope, f.realParams[i]);
+    return text + ")";
+};
+
+// Only + - * between terms: the other operators reject most integer operands in Parser.
+// One term may be a parenthesized expression, so the text grows linearly with the depth.
+std::string ProgramGenerator::expr(const Scope_t& scope, bool real, unsigned depth) {
+    static const char* const operators[] = { " + ", " - ", " * " };
+    unsigned terms = _options.mix == Mix::Expressions ? 4 + pick(9) : 1 + pick(3), nested = pick(terms);
+    std::string text = chance(10) ? "-" : "";
+    for (unsigned i = 0; i < terms; ++i) {
+        if (i)
+            text += operators[pick(3)];
+        if (depth && i == nested && (_options.mix == Mix::Expressions || chance(15)))
+            text += "(" + expr(scope, real, depth - 1) + ")";
+        else if (scope.body && _options.mix == Mix::Balanced && chance(5))
+            text += call(scope);
+        else
+            text += operand(scope, real);
+    };
+    return text;
+};
+
+void ProgramGenerator::constSection() {
+    emit("const\n");
+    for (unsigned i = 0; i < _options.depth; ++i)
+        emit(indent(1) + name("n", i) + " = " + std::to_string(2 + pick(6)) + ";\n");
+    for (unsigned i = 0; i < _options.depth; ++i) {
+        Scope_t literals = {};
+        bool real = chance(30);
+        if (chance(30))
+            emit(indent(1) + name("c", i) + ": " + (real ? "real = " + realLiteral() : "integer = " + intLiteral()) + ";\n");
+        else
+            emit(indent(1) + name("c", i) + " = " + expr(literals, real, 1) + ";\n");
+    };
+    emit("\n");
+};
+
+// r0 .. r(depth - 1), each record holding the one before it, some also an inline record
+void ProgramGenerator::typeSection() {
+    emit("type\n");
+    for (unsigned k = 0; k < _options.depth; ++k) {
+        std::string record = indent(1) + name("r", k) + " = record\n";
+        _recordValues.push_back(std::string());
+        std::string& init = _recordValues.back();
+        init = "(";
+        unsigned fields = 1 + pick(3);
+        for (unsigned i = 0; i < fields; ++i) {
+            bool real = chance(50);
+            record += indent(2) + name("x", i) + (real ? ": real;\n" : ": integer;\n");
+            init += name("x", i) + ": " + (real ? realLiteral() : intLiteral()) + "; ";
+        };
+        if (k) {
+            record += indent(2) + name("y", k) + ": " + name("r", k - 1) + ";\n";
+            init += name("y", k) + ": " + _recordValues[k - 1] + "; ";
+        };
+        if (k > 1 && chance(50)) {
+            record += indent(2) + name("z", k) + ": record\n" + indent(3) + name("x", 0) + ": integer;\n" + indent(2) + "end;\n";
+            init += name("z", k) + ": (" + name("x", 0) + ": " + intLiteral() + ";); ";
+        };
+        init.back() = ')';
+        emit(record + indent(1) + "end;\n");
+    };
+    for (unsigned k = 0; k < _options.depth; ++k)
+        emit(indent(1) + name("t", k) + " = array [1.." + name("n", k) + "] of " + (chance(50) ? "real" : "integer") + ";\n");
+    emit("\n");
+};
+
+// Globals come in sections of eight. Arrays and records get initializers and are never used
+// again.
+void ProgramGenerator::varSections(Scope_t& scope) {
+    const unsigned perSection = 8;
+    bool reals = _options.mix != Mix::Codegen;
+    emit("var\n");
+    for (unsigned i = 0; i < _options.depth; ++i)
+        scope.loops.push_back(name("i", i));
+    std::string loops;
+    for (auto& i : scope.loops)
+        loops += (loops.empty() ? "" : ", ") + i;
+    emit(indent(1) + loops + ": integer;\n");
+
+    for (unsigned i = 0; i < _options.identifiers; ++i) {
+        if (i && i % perSection == 0)
+            emit("var\n");
+        bool real = reals && chance(30);
+        std::string identifier = name(real ? "h" : "g", i);
+        (real ? scope.reals : scope.integers).push_back(identifier);
+        if (chance(25))
+            emit(indent(1) + identifier + (real ? ": real = " + realLiteral() : ": integer = " + intLiteral()) + ";\n");
+        else
+            emit(indent(1) + identifier + (real ? ": real;\n" : ": integer;\n"));
+    };
+    if (_options.mix == Mix::Codegen)
+        return;
+
+    emit("var\n");
+    for (unsigned k = 0; k < _options.depth; ++k) {
+        unsigned length = 1 + pick(4);
+        std::string values;
+        for (unsigned i = 0; i < length; ++i)
+            values += (i ? ", " : "") + intLiteral();
+        emit(indent(1) + name("a", k) + ": array [1.." + std::to_string(length) + "] of integer = (" + values + ");\n");
+        emit(indent(1) + name("q", k) + ": " + name("r", k) + " = " + _recordValues[k] + ";\n");
+    };
+    emit(indent(1) + name("m", 0) + ": array [1..2] of array [1..2] of real = ((" + realLiteral() + ", " + realLiteral() + "), (" +
+         realLiteral() + ", " + realLiteral() + "));\n");
+    emit(indent(1) + name("b", 0) + ": array [1..2] of " + name("r", _options.depth - 1) + " = (" +
+         _recordValues[_options.depth - 1] + ", " + _recordValues[_options.depth - 1] + ");\n");
+    emit(indent(1) + name("u", 0) + ": " + name("t", 0) + ";\n");
+    emit("\n");
+};
+
+void ProgramGenerator::routine(size_t k) {
+    bool function = chance(50);
+    Routine_t r = { name(function ? "f" : "p", k), {}, function };
+    Scope_t scope = {};
+    std::string params;
+    for (unsigned i = 0, amount = pick(4); i < amount; ++i) {
+        bool real = chance(30);
+        std::string identifier = name("a", i);
+        r.realParams.push_back(real);
+        (real ? scope.reals : scope.integers).push_back(identifier);
+        params += (i ? "; " : "") + identifier + (real ? ": real" : ": integer");
+    };
+    bool real = chance(30);
+    if (function)
+        emit("function " + r.name + "(" + params + "): " + (real ? "real;\n" : "integer;\n"));
+    else
+        emit("procedure " + r.name + "(" + params + ");\n");
+
+    emit("var\n");
+    for (unsigned i = 0; i < _options.depth; ++i)
+        scope.loops.push_back(name("i", i));
+    std::string locals;
+    for (auto& i : scope.loops)
+        locals += (locals.empty() ? "" : ", ") + i;
+    for (unsigned i = 0; i < _options.identifiers; ++i) {
+        real = chance(30);
+        std::string identifier = name(real ? "w" : "v", i);
+        (real ? scope.reals : scope.integers).push_back(identifier);
+        if (!real)
+            locals += ", " + identifier;
+    };
+    emit(indent(1) + locals + ": integer;\n");
+    std::string reals;
+    for (size_t i = std::count(r.realParams.begin(), r.realParams.end(), true); i < scope.reals.size(); ++i)
+        reals += (reals.empty() ? "" : ", ") + scope.reals[i];
+    if (!reals.empty())
+        emit(indent(1) + reals + ": real;\n");
+    if (chance(30))
+        emit(indent(1) + name("l", 0) + ": " + name("r", pick(_options.depth)) + ";\n");
+
+    emit("begin\n");
+    statements(scope, 1, _options.depth);
+    emit("end;\n\n");
+    if (function)
+        _functions.push_back(_routines.size());
+    _routines.push_back(r);
+};
+
+// One statement of the block may nest, so a block grows linearly with the depth
+void ProgramGenerator::statements(const Scope_t& scope, unsigned level, unsigned depth) {
+    unsigned amount = 1 + pick(3), nested = pick(amount);
+    for (unsigned i = 0; i < amount; ++i)
+        statement(scope, level, i == nested ? depth : 0);
+};
+
+void ProgramGenerator::statement(const Scope_t& scope, unsigned level, unsigned depth) {
+    static const char* const comparisons[] = { " = ", " <> ", " < ", " > ", " <= ", " >= " };
+    bool codegen = _options.mix == Mix::Codegen;
+    std::string margin = indent(level);
+    if (_options.mix == Mix::Lexer && chance(50))
+        emit(margin + comment() + "\n");
+
+    unsigned choice = depth ? (codegen ? 0 : pick(3)) : 3 + pick(codegen ? 2 : 4);
+    if (choice == 0) {
+        bool real = !codegen && chance(20);
+        // "if -x" would read as the binary operator "if - x"
+        std::string left = expr(scope, real, 1);
+        if (left[0] == '-')
+            left = "(" + left + ")";
+        emit(margin + "if " + left + comparisons[pick(6)] + expr(scope, real, 1) + " then\n" + margin + "begin\n");
+        statements(scope, level + 1, depth - 1);
+        emit(margin + "end");
+        if (chance(40)) {
+            emit("\n" + margin + "else\n" + margin + "begin\n");
+            statements(scope, level + 1, 0);
+            emit(margin + "end");
+        };
+        emit(";\n");
+    }
+    else if (choice == 1 || choice == 2) {
+        const std::string& control = scope.loops[_options.depth - depth];
+        bool down = chance(20);
+        emit(margin + "for " + control + " := " + (down ? intLiteral() + " downto 1" : "1 to " + intLiteral()) + " do\n" + margin + "begin\n");
+        statements(scope, level + 1, depth - 1);
+        emit(margin + "end;\n");
+    }
+    else if (choice == 3 && !scope.integers.empty())
+        emit(margin + scope.integers[pick(static_cast<unsigned>(scope.integers.size()))] + " := " + expr(scope, false, _options.depth) + ";\n");
+    else if (choice == 4)
+        emit(margin + (chance(50) ? "writeln(" : "write(") + (codegen ? "" : stringLiteral() + ", ") + expr(scope, false, 1) + ");\n");
+    else if (choice == 5 && !scope.reals.empty())
+        emit(margin + scope.reals[pick(static_cast<unsigned>(scope.reals.size()))] + " := " + expr(scope, true, _options.depth) + ";\n");
+    else if (choice == 6 && scope.body && !_routines.empty()) {
+        const Routine_t& r = _routines[pick(static_cast<unsigned>(_routines.size()))];
+        std::string args;
+        for (size_t i = 0; i < r.realParams.size(); ++i)
+            args += (i ? ", " : "") + operand(scope, r.realParams[i]);
+        emit(margin + r.name + "(" + args + ");\n");
+    }
+    else
+        emit(margin + scope.loops.front() + " := " + expr(scope, false, 0) + ";\n");
+};
+
+void ProgramGenerator::generate(std::ostream& os) {
+    _os = &os;
+    _out.clear();
+    _written = 0;
+    _rng.seed(_options.seed);
+    _recordValues.clear();
+    _routines.clear();
+    _functions.clear();
+
+    emit("program synthetic;\n\n");
+    constSection();
+    typeSection();
+    Scope_t globals = {};
+    globals.body = true;
+    varSections(globals);
+
+    // Routines don't see the globals. With routines the body stays short and the bulk goes to
+    // them; the symbols mix spends it on the body, where every name is a global looked up
+    // among all the others, the codegen one on the body AsmCode translates
+    bool routines = _options.mix != Mix::Symbols && _options.mix != Mix::Codegen;
+    size_t body = _options.size / 4 < BodySize ? _options.size / 4 : BodySize;
+    for (size_t k = 0; routines && _written + body < _options.size; ++k)
+        routine(k);
+
+    emit("begin\n");
+    while (_written < _options.size)
+        statement(globals, 1, _options.depth);
+    emit("end.\n");
+    os << _out;
+    _out.clear();
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Random programs in the dialect Parser accepts, for stress tests and Benchmark::suite.
+// Everything generated parses: identifiers are declared before use and only where Parser
+// looks them up (a routine sees its parameters and locals, the program body the globals
+// and routines), constants appear in const sections and array bounds only, arrays and
+// records in declarations with initializers only, and expressions stick to + - * and
+// comparisons over integer and real operands.
+// The same options give the same text everywhere: the engine is used without the standard
+// distributions, whose output differs between library implementations.
+class ProgramGenerator {
+    public:
+        // Which hot path the bulk of the program leans on
+        enum class Mix {
+            Balanced,       // declarations, routines with nested if/for, a short program body
+            Lexer,          // long identifiers, comments and literals of every kind: many tokens, few nodes
+            Symbols,        // many globals in one scope, a body referring to all of them: SymbolTable
+            Expressions,    // long nested mixed integer/real expressions: validateAndReturnExprType
+            Codegen,        // integer assignments, if and writeln in the program body: AsmCode
+        };
+
+        struct Options_t {
+            size_t size;            // bytes, the program ends after the first statement past it
+            unsigned depth;         // nesting of if/for, of records and of parentheses
+            unsigned identifiers;   // global variables, and locals per routine
+            uint32_t seed;
+            Mix mix;
+        };
+
+        static const Options_t Defaults;
+
+        ProgramGenerator(const Options_t& options);
+
+        void generate(std::ostream& os);
+
+        // "balanced", "lexer", "symbols", "expressions" or "codegen"
+        static bool findMix(const std::string& name, Mix& mix);
+        static const char* mixName(Mix mix);
+
+    private:
+        struct Routine_t {
+            std::string name;
+            std::vector<bool> realParams;
+            bool function;
+        };
+
+        struct Scope_t {
+            std::vector<std::string> integers;
+            std::vector<std::string> reals;
+            std::vector<std::string> loops;
+            bool body;
+        };
+
+        unsigned pick(unsigned n) { return static_cast<unsigned>(_rng() % n); };
+        bool chance(unsigned percent) { return pick(100) < percent; };
+        std::string name(const char* kind, size_t k) const;
+        std::string indent(unsigned level) const { return std::string(4 * level, ' '); };
+        void emit(const std::string& text);
+
+        std::string intLiteral();
+        std::string realLiteral();
+        std::string stringLiteral();
+        std::string comment();
+        std::string operand(const Scope_t& scope, bool real);
+        std::string expr(const Scope_t& scope, bool real, unsigned depth);
+        std::string call(const Scope_t& scope);
+
+        void constSection();
+        void typeSection();
+        void varSections(Scope_t& scope);
+        void routine(size_t k);
+        void statements(const Scope_t& scope, unsigned level, unsigned depth);
+        void statement(const Scope_t& scope, unsigned level, unsigned depth);
+
+        Options_t _options;
+        std::mt19937 _rng;
+        std::ostream* _os;
+        std::string _out;
+        size_t _written;
+        // initializer of each record type r0 .. r(depth - 1)
+        std::vector<std::string> _recordValues;
+        std::vector<Routine_t> _routines;
+        std::vector<size_t> _functions;
+        static const size_t FlushSize = 64 * 1024;
+        static const size_t BodySize = 64 * 1024;
+        static const char* const _mixNames[];
+};
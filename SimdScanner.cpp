@@ -0,0 +1,158 @@
+#include "SimdScanner.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_SCANNER_SSE2
+#endif
+
+#if defined(SIMD_SCANNER_AVX2)
+typedef __m256i Chunk_t;
+const size_t SimdScanner::ChunkSize = 32;
+static inline Chunk_t load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); };
+static inline Chunk_t splat(char c) { return _mm256_set1_epi8(c); };
+static inline Chunk_t eq(Chunk_t a, Chunk_t b) { return _mm256_cmpeq_epi8(a, b); };
+static inline Chunk_t gt(Chunk_t a, Chunk_t b) { return _mm256_cmpgt_epi8(a, b); };
+static inline Chunk_t either(Chunk_t a, Chunk_t b) { return _mm256_or_si256(a, b); };
+static inline Chunk_t both(Chunk_t a, Chunk_t b) { return _mm256_and_si256(a, b); };
+static inline unsigned int bits(Chunk_t a) { return static_cast<unsigned int>(_mm256_movemask_epi8(a)); };
+#elif defined(SIMD_SCANNER_SSE2)
+typedef __m128i Chunk_t;
+const size_t SimdScanner::ChunkSize = 16;
+static inline Chunk_t load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+static inline Chunk_t splat(char c) { return _mm_set1_epi8(c); };
+static inline Chunk_t eq(Chunk_t a, Chunk_t b) { return _mm_cmpeq_epi8(a, b); };
+static inline Chunk_t gt(Chunk_t a, Chunk_t b) { return _mm_cmpgt_epi8(a, b); };
+static inline Chunk_t either(Chunk_t a, Chunk_t b) { return _mm_or_si128(a, b); };
+static inline Chunk_t both(Chunk_t a, Chunk_t b) { return _mm_and_si128(a, b); };
+static inline unsigned int bits(Chunk_t a) { return static_cast<unsigned int>(_mm_movemask_epi8(a)); };
+#else
+const size_t SimdScanner::ChunkSize = 1;
+#endif
+
+const char* SimdScanner::instructionSet() {
+#if defined(SIMD_SCANNER_AVX2)
+    return "AVX2";
+#elif defined(SIMD_SCANNER_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+};
+
+#if defined(SIMD_SCANNER_AVX2) || defined(SIMD_SCANNER_SSE2)
+static inline unsigned int countTrailingZeros(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+};
+
+// The printable bytes the generated table takes state out on, its rules and its illegal
+// characters alike. Filtering on these keeps the skip in step with whatever the spec says.
+struct Exits_t {
+    char bytes[8];
+    unsigned int amount;
+};
+
+static constexpr Exits_t exits(FiniteAutomata::States state) {
+    Exits_t result = {};
+    for (unsigned int b = ' '; b < 0x7F; ++b)
+        if (FiniteAutomata::states[FiniteAutomata::row(state)][FiniteAutomata::classes[b]] != state) {
+            if (result.amount < sizeof(result.bytes))
+                result.bytes[result.amount] = static_cast<char>(b);
+            ++result.amount;
+        };
+    return result;
+};
+
+static constexpr Exits_t commentExits = exits(FiniteAutomata::States::Comment);
+static constexpr Exits_t multilineCommentExits = exits(FiniteAutomata::States::MultilineComment);
+static constexpr Exits_t stringExits = exits(FiniteAutomata::States::String);
+static_assert(commentExits.amount <= sizeof(commentExits.bytes) &&
+              multilineCommentExits.amount <= sizeof(multilineCommentExits.bytes) &&
+              stringExits.amount <= sizeof(stringExits.bytes), "too many exits to compare a chunk against");
+
+// Control bytes, DEL, UTF-8 (the signed compare flags every byte >= 0x80) and the exits
+static inline unsigned int flag(Chunk_t c, const Exits_t& exits) {
+    Chunk_t mask = either(gt(splat(' '), c), eq(c, splat(0x7F)));
+    for (unsigned int i = 0; i < exits.amount; ++i)
+        mask = either(mask, eq(c, splat(exits.bytes[i])));
+    return bits(mask);
+};
+
+// Bit i is set when chunk[i] may leave state or is part of a UTF-8 sequence, leaves() has
+// the final word.
+unsigned int SimdScanner::candidates(FiniteAutomata::States state, const char* chunk) {
+    const unsigned int all = ChunkSize == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+    Chunk_t c = load(chunk);
+    switch (state) {
+    case FiniteAutomata::States::Whitespace:
+        return ~bits(either(eq(c, splat(' ')), eq(c, splat('\t')))) & all;
+    case FiniteAutomata::States::Identifier: {
+        // signed compares: bytes >= 0x80 are negative and fall out of every range
+        Chunk_t lower = either(c, splat(0x20));
+        Chunk_t letter = both(gt(lower, splat('a' - 1)), gt(splat('z' + 1), lower));
+        Chunk_t digit = both(gt(c, splat('0' - 1)), gt(splat('9' + 1), c));
+        return ~bits(either(either(letter, digit), eq(c, splat('_')))) & all;
+    }
+    case FiniteAutomata::States::Comment:
+        return flag(c, commentExits);
+    case FiniteAutomata::States::String:
+        return flag(c, stringExits);
+    case FiniteAutomata::States::MultilineComment:
+        return flag(c, multilineCommentExits);
+    default:
+        return 1;
+    };
+};
+#endif
+
+const char* SimdScanner::skipRun(FiniteAutomata::States state, const char* from, const char* to) {
+    switch (state) {
+    case FiniteAutomata::States::Whitespace:
+    case FiniteAutomata::States::Identifier:
+    case FiniteAutomata::States::Comment:
+    case FiniteAutomata::States::MultilineComment:
+    case FiniteAutomata::States::String:
+        break;
+    default:
+        return from;
+    };
+#if defined(SIMD_SCANNER_AVX2) || defined(SIMD_SCANNER_SSE2)
+    while (static_cast<size_t>(to - from) >= ChunkSize) {
+        unsigned int mask = candidates(state, from);
+        if (!mask) {
+            from += ChunkSize;
+            continue;
+        };
+        from += countTrailingZeros(mask);
+        if (leaves(state, *from))
+            return from;
+        ++from;
+    };
+#endif
+    while (from != to && !leaves(state, *from))
+        ++from;
+    return from;
+};
+
+const char* SimdScanner::lineBreak(const char* from, const char* to) {
+#if defined(SIMD_SCANNER_AVX2) || defined(SIMD_SCANNER_SSE2)
+    while (static_cast<size_t>(to - from) >= ChunkSize) {
+        Chunk_t c = load(from);
+        unsigned int mask = bits(either(eq(c, splat('\n')), eq(c, splat('\r'))));
+        if (mask)
+            return from + countTrailingZeros(mask);
+        from += ChunkSize;
+    };
+#endif
+    while (from != to && !isLineBreak(*from))
+        ++from;
+    return from;
+};
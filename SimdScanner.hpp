@@ -0,0 +1,27 @@
+#pragma once
+#include "FiniteAutomata.hpp"
+#include <cstddef>
+
+// Vectorized skipping of the states the DFA spends most of its steps in: whitespace,
+// both comment kinds, string literals and identifier runs. Uses AVX2 (32-byte chunks) when the compiler
+// targets it, SSE2 (16 bytes) otherwise on x86/x64 and a plain table walk elsewhere.
+class SimdScanner {
+    public:
+        // First position in [from, to) whose byte would take the DFA out of state or starts
+        // a UTF-8 sequence, which the lexer checks itself. Returns from for states without
+        // a fast path. The bytes skipped are plain ASCII and never contain a line break.
+        static const char* skipRun(FiniteAutomata::States state, const char* from, const char* to);
+        // First byte in [from, to) the lexer counts rows on, to if there is none
+        static const char* lineBreak(const char* from, const char* to);
+        static const char* instructionSet();
+        static const size_t ChunkSize;
+
+    private:
+        static bool leaves(FiniteAutomata::States state, char c) {
+            return (c & 0x80) || FiniteAutomata::next(state, c) != state;
+        };
+        static bool isLineBreak(char c) {
+            return FiniteAutomata::classes[static_cast<unsigned char>(c)] == FiniteAutomata::classes[static_cast<unsigned char>('\n')];
+        };
+        static unsigned int candidates(FiniteAutomata::States state, const char* chunk);
+};
@@ -0,0 +1,98 @@
+#include "SourceBuffer.hpp"
+#include <iostream>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+SourceBuffer::SourceBuffer(const std::string& filename) : _begin(nullptr), _end(nullptr), _mapping(nullptr), _mappedSize(0) {
+    open(filename);
+};
+
+SourceBuffer::~SourceBuffer() {
+    close();
+};
+
+void SourceBuffer::open(const std::string& filename) {
+    close();
+    if (filename == "-") {
+        read(std::cin);
+        return;
+    };
+    if (map(filename))
+        return;
+    std::ifstream file(filename, std::ios::binary);
+    read(file);
+};
+
+void SourceBuffer::close() {
+    if (_mapping) {
+#ifdef _WIN32
+        UnmapViewOfFile(_mapping);
+#else
+        munmap(_mapping, _mappedSize);
+#endif
+    };
+    _mapping = nullptr;
+    _mappedSize = 0;
+    _storage.clear();
+    _begin = _end = nullptr;
+};
+
+// Empty and missing files fall through to read(), which leaves an empty buffer,
+// the same thing the old ifstream-based lexer saw for them.
+bool SourceBuffer::map(const std::string& filename) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    };
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+        return false;
+    _mappedSize = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    };
+    void* view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+    madvise(view, st.st_size, MADV_SEQUENTIAL);
+    _mappedSize = static_cast<size_t>(st.st_size);
+#endif
+    _mapping = view;
+    _begin = static_cast<const char*>(view);
+    _end = _begin + _mappedSize;
+    return true;
+};
+
+void SourceBuffer::read(std::istream& is) {
+    _storage.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    _begin = _storage.data();
+    _end = _begin + _storage.size();
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Whole-file view of a source text. Regular files are memory-mapped, stdin ("-")
+// and anything that can't be mapped is read in one shot into an owned buffer.
+// The lexer walks [begin(), end()) with a raw pointer and tokens keep spans into it,
+// so the buffer must outlive every token produced from it.
+class SourceBuffer {
+    public:
+        SourceBuffer() : _begin(nullptr), _end(nullptr), _mapping(nullptr), _mappedSize(0) {};
+        SourceBuffer(const std::string& filename);
+        SourceBuffer(const SourceBuffer&) = delete;
+        SourceBuffer& operator=(const SourceBuffer&) = delete;
+        ~SourceBuffer();
+
+        void open(const std::string& filename);
+        void close();
+
+        const char* begin() const { return _begin; };
+        const char* end() const { return _end; };
+        size_t size() const { return _end - _begin; };
+        bool isMapped() const { return _mapping != nullptr; };
+        std::string_view span(const char* from, const char* to) const { return std::string_view(from, to - from); };
+
+    private:
+        bool map(const std::string& filename);
+        void read(std::istream& is);
+
+        const char* _begin;
+        const char* _end;
+        void* _mapping;
+        size_t _mappedSize;
+        std::vector<char> _storage;
+};
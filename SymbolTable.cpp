@@ -0,0 +1,96 @@
+#include "SymbolTable.hpp"
+
+SymbolTable::SymbolTable() {
+    clear();
+};
+
+void SymbolTable::clear() {
+    _slots.assign(InitialSlots, { Interner::NoSymbol, NoBinding });
+    _shift = 32;
+    for (size_t n = InitialSlots; n > 1; n >>= 1)
+        --_shift;
+    _used = 0;
+    _bindings.clear();
+    _log.clear();
+    _scopes.clear();
+    _barrier = 0;
+    _horizon = NoHorizon;
+};
+
+// Fibonacci hashing: ids of one program are mostly consecutive, the multiplication spreads
+// them over the high bits
+size_t SymbolTable::probe(Interner::Symbol_t symbol) const {
+    size_t mask = _slots.size() - 1;
+    size_t i = static_cast<uint32_t>(symbol * 0x9E3779B9u) >> _shift;
+    while (_slots[i].symbol != symbol && _slots[i].symbol != Interner::NoSymbol)
+        i = (i + 1) & mask;
+    return i;
+};
+
+// Names stay in the table once seen, a popped one keeps its slot with NoBinding
+void SymbolTable::grow() {
+    std::vector<Slot_t> slots(2 * _slots.size(), { Interner::NoSymbol, NoBinding });
+    std::swap(slots, _slots);
+    --_shift;
+    for (const Slot_t& s : slots)
+        if (s.symbol != Interner::NoSymbol)
+            _slots[probe(s.symbol)] = s;
+};
+
+void SymbolTable::pushScope(bool opaque) {
+    _scopes.push_back({ _log.size(), _barrier });
+    if (opaque)
+        _barrier = static_cast<uint32_t>(_scopes.size());
+};
+
+void SymbolTable::popScope() {
+    Scope_t scope = _scopes.back();
+    for (size_t i = _log.size(); i > scope.logSize; --i) {
+        const Declaration_t& d = _bindings[_log[i - 1]];
+        _slots[probe(d.symbol)].innermost = d.shadowed;
+    };
+    _log.resize(scope.logSize);
+    _barrier = scope.barrier;
+    _scopes.pop_back();
+};
+
+SymbolTable::Binding_t SymbolTable::declare(Interner::Symbol_t symbol, const Entry_t& entry, uint32_t position) {
+    if (2 * (_used + 1) > _slots.size())
+        grow();
+    Slot_t& slot = _slots[probe(symbol)];
+    if (slot.symbol == Interner::NoSymbol) {
+        slot.symbol = symbol;
+        ++_used;
+    };
+    Binding_t binding = static_cast<Binding_t>(_bindings.size());
+    _bindings.push_back({ entry, symbol, slot.innermost, static_cast<uint32_t>(_scopes.size()), position });
+    slot.innermost = binding;
+    _log.push_back(binding);
+    return binding;
+};
+
+SymbolTable::Binding_t SymbolTable::innermost(Interner::Symbol_t symbol) const {
+    Binding_t binding = _slots[probe(symbol)].innermost;
+    while (binding != NoBinding && _bindings[binding].position >= _horizon)
+        binding = _bindings[binding].shadowed;
+    return binding;
+};
+
+// A newer binding never sits in an outer scope than an older one it shadows, so only the
+// innermost binding of a name has to be checked against the barrier
+SymbolTable::Binding_t SymbolTable::lookup(Interner::Symbol_t symbol) const {
+    Binding_t binding = innermost(symbol);
+    if (binding == NoBinding || _bindings[binding].scope < _barrier)
+        return NoBinding;
+    return binding;
+};
+
+bool SymbolTable::declaresLocally(Interner::Symbol_t symbol) const {
+    Binding_t binding = innermost(symbol);
+    return binding != NoBinding && _bindings[binding].scope == _scopes.size();
+};
+
+SymbolTable::Entry_t* SymbolTable::find(Interner::Symbol_t symbol) {
+    Binding_t binding = lookup(symbol);
+    return binding == NoBinding ? nullptr : &_bindings[binding].entry;
+};
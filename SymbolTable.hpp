@@ -0,0 +1,83 @@
+#pragma once
+#include "Interner.hpp"
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+class Node;
+
+// Names in scope for the parser. One open-addressing table maps an interned name to its
+// innermost binding, and each binding links to the one of the same name it shadows.
+// A scope logs the bindings declared in it, so popping it costs one step per binding.
+// Popped bindings aren't freed before clear(): binding ids and entry pointers stay valid,
+// and nodes can keep what their name resolved to.
+// Each binding also records where it was declared, so that lookups can be limited to the
+// declarations before some point of the source (see setHorizon).
+class SymbolTable {
+    public:
+        // The type node and the value node (or the routine) of a declaration
+        typedef std::pair<Node*, Node*> Entry_t;
+        typedef uint32_t Binding_t;
+        static const Binding_t NoBinding = 0xFFFFFFFF;
+        static const uint32_t NoHorizon = 0xFFFFFFFF;
+
+        SymbolTable();
+
+        // Back to a single empty scope
+        void clear();
+        // An opaque scope hides everything declared outside of it, as a routine body does
+        void pushScope(bool opaque = false);
+        // The names the innermost scope shadowed are visible again
+        void popScope();
+        // A binding in the innermost scope, shadowing any other of the same name. position is
+        // where the declaration is, a source offset
+        Binding_t declare(Interner::Symbol_t symbol, const Entry_t& entry, uint32_t position);
+        // The innermost visible binding of symbol, NoBinding if there is none
+        Binding_t lookup(Interner::Symbol_t symbol) const;
+        // Whether the innermost scope itself declares symbol
+        bool declaresLocally(Interner::Symbol_t symbol) const;
+        Entry_t& entry(Binding_t binding) { return _bindings[binding].entry; };
+        uint32_t position(Binding_t binding) const { return _bindings[binding].position; };
+        // lookup and entry together, nullptr if symbol isn't visible
+        Entry_t* find(Interner::Symbol_t symbol);
+        // Bindings declared at horizon or past it are left out of lookups, NoHorizon shows all
+        void setHorizon(uint32_t horizon) { _horizon = horizon; };
+
+    private:
+        struct Declaration_t {
+            Entry_t entry;
+            Interner::Symbol_t symbol;
+            Binding_t shadowed;
+            uint32_t scope;
+            uint32_t position;
+        };
+
+        struct Slot_t {
+            Interner::Symbol_t symbol;
+            Binding_t innermost;
+        };
+
+        struct Scope_t {
+            size_t logSize;
+            uint32_t barrier;
+        };
+
+        // The slot of symbol, or the empty one where it would go
+        size_t probe(Interner::Symbol_t symbol) const;
+        // The innermost binding of symbol before the horizon, in scope or not
+        Binding_t innermost(Interner::Symbol_t symbol) const;
+        void grow();
+
+        std::vector<Slot_t> _slots;
+        unsigned _shift;
+        size_t _used;
+        std::deque<Declaration_t> _bindings;
+        // the live bindings, innermost scope last
+        std::vector<Binding_t> _log;
+        std::vector<Scope_t> _scopes;
+        // depth of the innermost opaque scope, bindings below it are hidden
+        uint32_t _barrier;
+        uint32_t _horizon;
+        static const size_t InitialSlots = 256;
+};
@@ -1,165 +1,303 @@
-#include "Token.hpp"
-
-const Token::Dict_t Token::_dict = {
-    { "+",                 { Token::SubClass::Add,              Token::Class::Operator }},
-    { "-",                 { Token::SubClass::Sub,              Token::Class::Operator }},
-    { "*",                 { Token::SubClass::Mult,             Token::Class::Operator }},
-    { "/",                 { Token::SubClass::Div,              Token::Class::Operator }},
-    { "=",                 { Token::SubClass::Equal,            Token::Class::Operator }},
-    { "<",                 { Token::SubClass::Less,             Token::Class::Operator }},
-    { ">",                 { Token::SubClass::More,             Token::Class::Operator }},
-    { "@",                 { Token::SubClass::Address,          Token::Class::Operator }},
-    { "^",                 { Token::SubClass::Pointer,          Token::Class::Operator }},
-    { ".",                 { Token::SubClass::Dot,              Token::Class::Operator }},
-    { "+=",                { Token::SubClass::AddAssign,        Token::Class::Operator }},
-    { "-=",                { Token::SubClass::SubAssign,        Token::Class::Operator }},
-    { "*=",                { Token::SubClass::MultAssign,       Token::Class::Operator }},
-    { "/=",                { Token::SubClass::DivAssign,        Token::Class::Operator }},
-    { ":=",                { Token::SubClass::Assign,           Token::Class::Operator }},
-    { "<=",                { Token::SubClass::LEQ,              Token::Class::Operator }},
-    { ">=",                { Token::SubClass::MEQ,              Token::Class::Operator }},
-    { "<<",                { Token::SubClass::SHL,              Token::Class::Operator }},
-    { ">>",                { Token::SubClass::SHR,              Token::Class::Operator }},
-    { "<>",                { Token::SubClass::NEQ,              Token::Class::Operator }},
-    { "><",                { Token::SubClass::SymDiff,          Token::Class::Operator }},
-    { "**",                { Token::SubClass::Exp,              Token::Class::Operator }},
-    { "..",                { Token::SubClass::Subrange,         Token::Class::Operator }},
-    { "and",               { Token::SubClass::And,              Token::Class::Operator }},
-    { "or",                { Token::SubClass::Or,               Token::Class::Operator }},
-    { "div",               { Token::SubClass::IntDiv,           Token::Class::Operator }},
-    { "mod",               { Token::SubClass::Mod,              Token::Class::Operator }},
-    { "not",               { Token::SubClass::Not,              Token::Class::Operator }},
-    { "shl",               { Token::SubClass::SHL,              Token::Class::Operator }},
-    { "shr",               { Token::SubClass::SHR,              Token::Class::Operator }},
-    { "xor",               { Token::SubClass::Xor,              Token::Class::Operator }},
-                              
-    { ":",                 { Token::SubClass::Colon,            Token::Class::Separator }},
-    { ",",                 { Token::SubClass::Comma,            Token::Class::Separator }},
-    { ";",                 { Token::SubClass::Semicolon,        Token::Class::Separator }},
-    { "[",                 { Token::SubClass::LeftBracket,      Token::Class::Separator }},
-    { "]",                 { Token::SubClass::RightBracket,     Token::Class::Separator }},
-    { "(.",                { Token::SubClass::LeftBracket,      Token::Class::Separator }},
-    { ".)",                { Token::SubClass::RightBracket,     Token::Class::Separator }},
-    { "(",                 { Token::SubClass::LeftParenthesis,  Token::Class::Separator }},
-    { ")",                 { Token::SubClass::RightParenthesis, Token::Class::Separator }},
-
-    { "absolute",          { Token::SubClass::Absolute,         Token::Class::ReservedWord }},
-    { "array",             { Token::SubClass::Array,            Token::Class::ReservedWord }},
-    { "asm",               { Token::SubClass::Asm,              Token::Class::ReservedWord }},
-    { "begin",             { Token::SubClass::Begin,            Token::Class::ReservedWord }},
-    { "break",             { Token::SubClass::Break,            Token::Class::ReservedWord }},
-    { "case",              { Token::SubClass::Case,             Token::Class::ReservedWord }},
-    { "const",             { Token::SubClass::Const,            Token::Class::ReservedWord }},
-    { "constructor",       { Token::SubClass::Constructor,      Token::Class::ReservedWord }},
-    { "continue",          { Token::SubClass::Continue,         Token::Class::ReservedWord }},
-    { "destructor",        { Token::SubClass::Destructor,       Token::Class::ReservedWord }},
-    { "do",                { Token::SubClass::Do,               Token::Class::ReservedWord }},
-    { "downto",            { Token::SubClass::DownTo,           Token::Class::ReservedWord }},
-    { "else",              { Token::SubClass::Else,             Token::Class::ReservedWord }},
-    { "end",               { Token::SubClass::End,              Token::Class::ReservedWord }},
-    { "false",             { Token::SubClass::False,            Token::Class::ReservedWord }},
-    { "file",              { Token::SubClass::File,             Token::Class::ReservedWord }},
-    { "for",               { Token::SubClass::For,              Token::Class::ReservedWord }},
-    { "function",          { Token::SubClass::Function,         Token::Class::ReservedWord }},
-    { "goto",              { Token::SubClass::Goto,             Token::Class::ReservedWord }},
-    { "if",                { Token::SubClass::If,               Token::Class::ReservedWord }},
-    { "implementation",    { Token::SubClass::Implementation,   Token::Class::ReservedWord }},
-    { "in",                { Token::SubClass::In,               Token::Class::ReservedWord }},
-    { "inline",            { Token::SubClass::Inline,           Token::Class::ReservedWord }},
-    { "interface",         { Token::SubClass::Interface,        Token::Class::ReservedWord }},
-    { "label",             { Token::SubClass::Label,            Token::Class::ReservedWord }},
-    { "nil",               { Token::SubClass::Nil,              Token::Class::ReservedWord }},
-    { "object",            { Token::SubClass::Object,           Token::Class::ReservedWord }},
-    { "of",                { Token::SubClass::Of,               Token::Class::ReservedWord }},
-    { "packed",            { Token::SubClass::Packed,           Token::Class::ReservedWord }},
-    { "procedure",         { Token::SubClass::Procedure,        Token::Class::ReservedWord }},
-    { "program",           { Token::SubClass::Program,          Token::Class::ReservedWord }},
-    { "record",            { Token::SubClass::Record,           Token::Class::ReservedWord }},
-    { "repeat",            { Token::SubClass::Repeat,           Token::Class::ReservedWord }},
-    { "set",               { Token::SubClass::Set,              Token::Class::ReservedWord }},
-    { "string",            { Token::SubClass::String,           Token::Class::ReservedWord }},
-    { "then",              { Token::SubClass::Then,             Token::Class::ReservedWord }},
-    { "to",                { Token::SubClass::To,               Token::Class::ReservedWord }},
-    { "true",              { Token::SubClass::True,             Token::Class::ReservedWord }},
-    { "type",              { Token::SubClass::Type,             Token::Class::ReservedWord }},
-    { "unit",              { Token::SubClass::Unit,             Token::Class::ReservedWord }},
-    { "until",             { Token::SubClass::Until,            Token::Class::ReservedWord }},
-    { "uses",              { Token::SubClass::Uses,             Token::Class::ReservedWord }},
-    { "var",               { Token::SubClass::Var,              Token::Class::ReservedWord }},
-    { "while",             { Token::SubClass::While,            Token::Class::ReservedWord }},
-    { "with",              { Token::SubClass::With,             Token::Class::ReservedWord }},
-};
-
-Token::Token(FiniteAutomata::States state, Position_t pos, std::string raw, std::string value) : _pos(pos), _raw(raw) {
-    switch (state) {
-    case FiniteAutomata::States::Identifier:
-    case FiniteAutomata::States::Operator:
-    case FiniteAutomata::States::OperatorDot:
-    case FiniteAutomata::States::OperatorGreater:
-    case FiniteAutomata::States::OperatorLess:
-    case FiniteAutomata::States::OperatorMult:
-    case FiniteAutomata::States::OperatorPlus:
-    case FiniteAutomata::States::Slash:
-    case FiniteAutomata::States::Colon:
-    case FiniteAutomata::States::Separator:
-    case FiniteAutomata::States::LeftParenthesis:
-        _vtype = ValueType::String;
-        _value.s = new char[value.length() + 1];
-        memcpy(_value.s, value.c_str(), value.length() + 1);
-        _class = _dict.count(value) ? _dict.at(value).second : Class::Identifier;
-        _subClass = _dict.count(value) ? _dict.at(value).first : SubClass::Identifier;
-        break;
-
-    case FiniteAutomata::States::Decimal:
-    case FiniteAutomata::States::Bin:
-    case FiniteAutomata::States::Hex:
-    case FiniteAutomata::States::Oct:
-        _vtype = ValueType::ULL;
-        _value.ull = std::stoull(value, 0, static_cast<unsigned int>(state));
-        _class = Class::Constant;
-        _subClass = SubClass::IntConst;
-        break;
-
-    case FiniteAutomata::States::Float:
-    case FiniteAutomata::States::FloatEnd:
-    case FiniteAutomata::States::FloatingPoint:
-        _vtype = ValueType::Double;
-        _value.d = std::stod(value);
-        _class = Class::Constant;
-        _subClass = SubClass::FloatConst;
-        break;
-
-    case FiniteAutomata::States::DecimalCharCode:
-    case FiniteAutomata::States::BinCharCode:
-    case FiniteAutomata::States::HexCharCode:
-    case FiniteAutomata::States::OctCharCode:
-    case FiniteAutomata::States::StringEnd:
-    case FiniteAutomata::States::EndOfFile:
-        _vtype = ValueType::String;
-        _value.s = new char[value.length() + 1];
-        memcpy(_value.s, value.c_str(), value.length() + 1);
-        _class = Class::StringLiteral;
-        _subClass = (state == FiniteAutomata::States::EndOfFile ? SubClass::EndOfFile : SubClass::StringLiteral);
-
-    default:
-        break;
-    };
-};
-
-std::string Token::toString() {
-    std::stringstream ss;
-    switch (_vtype) {
-    case Token::ValueType::ULL:
-        ss << _value.ull;
-        break;
-    case Token::ValueType::Double:
-        ss << std::scientific << _value.d;
-        break;
-    case Token::ValueType::String:
-        ss << _value.s;
-        break;
-    default:
-        break;
-    }
-    return ss.str();
+#include "Token.hpp"
+#include <algorithm>
+#include <cstring>
+
+constexpr Token::Keyword_t Token::_keywords[] = {
+    { "+",                1, Token::SubClass::Add,              Token::Class::Operator },
+    { "-",                1, Token::SubClass::Sub,              Token::Class::Operator },
+    { "*",                1, Token::SubClass::Mult,             Token::Class::Operator },
+    { "/",                1, Token::SubClass::Div,              Token::Class::Operator },
+    { "=",                1, Token::SubClass::Equal,            Token::Class::Operator },
+    { "<",                1, Token::SubClass::Less,             Token::Class::Operator },
+    { ">",                1, Token::SubClass::More,             Token::Class::Operator },
+    { "@",                1, Token::SubClass::Address,          Token::Class::Operator },
+    { "^",                1, Token::SubClass::Pointer,          Token::Class::Operator },
+    { ".",                1, Token::SubClass::Dot,              Token::Class::Operator },
+    { "+=",               2, Token::SubClass::AddAssign,        Token::Class::Operator },
+    { "-=",               2, Token::SubClass::SubAssign,        Token::Class::Operator },
+    { "*=",               2, Token::SubClass::MultAssign,       Token::Class::Operator },
+    { "/=",               2, Token::SubClass::DivAssign,        Token::Class::Operator },
+    { ":=",               2, Token::SubClass::Assign,           Token::Class::Operator },
+    { "<=",               2, Token::SubClass::LEQ,              Token::Class::Operator },
+    { ">=",               2, Token::SubClass::MEQ,              Token::Class::Operator },
+    { "<<",               2, Token::SubClass::SHL,              Token::Class::Operator },
+    { ">>",               2, Token::SubClass::SHR,              Token::Class::Operator },
+    { "<>",               2, Token::SubClass::NEQ,              Token::Class::Operator },
+    { "><",               2, Token::SubClass::SymDiff,          Token::Class::Operator },
+    { "**",               2, Token::SubClass::Exp,              Token::Class::Operator },
+    { "..",               2, Token::SubClass::Subrange,         Token::Class::Operator },
+    { "and",              3, Token::SubClass::And,              Token::Class::Operator },
+    { "or",               2, Token::SubClass::Or,               Token::Class::Operator },
+    { "div",              3, Token::SubClass::IntDiv,           Token::Class::Operator },
+    { "mod",              3, Token::SubClass::Mod,              Token::Class::Operator },
+    { "not",              3, Token::SubClass::Not,              Token::Class::Operator },
+    { "shl",              3, Token::SubClass::SHL,              Token::Class::Operator },
+    { "shr",              3, Token::SubClass::SHR,              Token::Class::Operator },
+    { "xor",              3, Token::SubClass::Xor,              Token::Class::Operator },
+                              
+    { ":",                1, Token::SubClass::Colon,            Token::Class::Separator },
+    { ",",                1, Token::SubClass::Comma,            Token::Class::Separator },
+    { ";",                1, Token::SubClass::Semicolon,        Token::Class::Separator },
+    { "[",                1, Token::SubClass::LeftBracket,      Token::Class::Separator },
+    { "]",                1, Token::SubClass::RightBracket,     Token::Class::Separator },
+    { "(.",               2, Token::SubClass::LeftBracket,      Token::Class::Separator },
+    { ".)",               2, Token::SubClass::RightBracket,     Token::Class::Separator },
+    { "(",                1, Token::SubClass::LeftParenthesis,  Token::Class::Separator },
+    { ")",                1, Token::SubClass::RightParenthesis, Token::Class::Separator },
+
+    { "absolute",         8, Token::SubClass::Absolute,         Token::Class::ReservedWord },
+    { "array",            5, Token::SubClass::Array,            Token::Class::ReservedWord },
+    { "asm",              3, Token::SubClass::Asm,              Token::Class::ReservedWord },
+    { "begin",            5, Token::SubClass::Begin,            Token::Class::ReservedWord },
+    { "break",            5, Token::SubClass::Break,            Token::Class::ReservedWord },
+    { "case",             4, Token::SubClass::Case,             Token::Class::ReservedWord },
+    { "const",            5, Token::SubClass::Const,            Token::Class::ReservedWord },
+    { "constructor",     11, Token::SubClass::Constructor,      Token::Class::ReservedWord },
+    { "continue",         8, Token::SubClass::Continue,         Token::Class::ReservedWord },
+    { "destructor",      10, Token::SubClass::Destructor,       Token::Class::ReservedWord },
+    { "do",               2, Token::SubClass::Do,               Token::Class::ReservedWord },
+    { "downto",           6, Token::SubClass::DownTo,           Token::Class::ReservedWord },
+    { "else",             4, Token::SubClass::Else,             Token::Class::ReservedWord },
+    { "end",              3, Token::SubClass::End,              Token::Class::ReservedWord },
+    { "false",            5, Token::SubClass::False,            Token::Class::ReservedWord },
+    { "file",             4, Token::SubClass::File,             Token::Class::ReservedWord },
+    { "for",              3, Token::SubClass::For,              Token::Class::ReservedWord },
+    { "function",         8, Token::SubClass::Function,         Token::Class::ReservedWord },
+    { "goto",             4, Token::SubClass::Goto,             Token::Class::ReservedWord },
+    { "if",               2, Token::SubClass::If,               Token::Class::ReservedWord },
+    { "implementation",  14, Token::SubClass::Implementation,   Token::Class::ReservedWord },
+    { "in",               2, Token::SubClass::In,               Token::Class::ReservedWord },
+    { "inline",           6, Token::SubClass::Inline,           Token::Class::ReservedWord },
+    { "interface",        9, Token::SubClass::Interface,        Token::Class::ReservedWord },
+    { "label",            5, Token::SubClass::Label,            Token::Class::ReservedWord },
+    { "nil",              3, Token::SubClass::Nil,              Token::Class::ReservedWord },
+    { "object",           6, Token::SubClass::Object,           Token::Class::ReservedWord },
+    { "of",               2, Token::SubClass::Of,               Token::Class::ReservedWord },
+    { "packed",           6, Token::SubClass::Packed,           Token::Class::ReservedWord },
+    { "procedure",        9, Token::SubClass::Procedure,        Token::Class::ReservedWord },
+    { "program",          7, Token::SubClass::Program,          Token::Class::ReservedWord },
+    { "record",           6, Token::SubClass::Record,           Token::Class::ReservedWord },
+    { "repeat",           6, Token::SubClass::Repeat,           Token::Class::ReservedWord },
+    { "set",              3, Token::SubClass::Set,              Token::Class::ReservedWord },
+    { "string",           6, Token::SubClass::String,           Token::Class::ReservedWord },
+    { "then",             4, Token::SubClass::Then,             Token::Class::ReservedWord },
+    { "to",               2, Token::SubClass::To,               Token::Class::ReservedWord },
+    { "true",             4, Token::SubClass::True,             Token::Class::ReservedWord },
+    { "type",             4, Token::SubClass::Type,             Token::Class::ReservedWord },
+    { "unit",             4, Token::SubClass::Unit,             Token::Class::ReservedWord },
+    { "until",            5, Token::SubClass::Until,            Token::Class::ReservedWord },
+    { "uses",             4, Token::SubClass::Uses,             Token::Class::ReservedWord },
+    { "var",              3, Token::SubClass::Var,              Token::Class::ReservedWord },
+    { "while",            5, Token::SubClass::While,            Token::Class::ReservedWord },
+    { "with",             4, Token::SubClass::With,             Token::Class::ReservedWord },
+};
+
+constexpr Token::KeywordSlots_t Token::buildKeywordSlots() {
+    KeywordSlots_t slots = {};
+    for (auto& i : slots)
+        i = NoKeyword;
+    for (unsigned char i = 0; i < sizeof(_keywords) / sizeof(_keywords[0]); ++i)
+        slots[keywordHash(_keywords[i].text, _keywords[i].length)] = i;
+    return slots;
+};
+
+constexpr Token::KeywordSlots_t Token::_keywordSlots = Token::buildKeywordSlots();
+
+constexpr bool Token::keywordSlotsArePerfect() {
+    for (unsigned char i = 0; i < sizeof(_keywords) / sizeof(_keywords[0]); ++i)
+        if (_keywordSlots[keywordHash(_keywords[i].text, _keywords[i].length)] != i ||
+            _keywords[i].length > MaxKeywordLength)
+            return false;
+    return true;
+};
+
+const Token::Keyword_t* Token::findKeyword(std::string_view s) {
+    static_assert(keywordSlotsArePerfect(), "keywordHash collides on Token::_keywords");
+    if (s.empty() || s.length() > MaxKeywordLength)
+        return nullptr;
+    unsigned char i = _keywordSlots[keywordHash(s.data(), s.length())];
+    if (i == NoKeyword || _keywords[i].length != s.length() || memcmp(_keywords[i].text, s.data(), s.length()))
+        return nullptr;
+    return &_keywords[i];
+};
+
+// Only string literals arrive with a decoded value, everything else is rebuilt from the raw span
+Token::Token(FiniteAutomata::States state, uint32_t offset, std::string_view raw, std::string_view value) :
+    _offset(offset), _length(static_cast<uint32_t>(raw.length())) {
+    std::string lowered;
+    switch (state) {
+    case FiniteAutomata::States::Identifier:
+    case FiniteAutomata::States::Operator:
+    case FiniteAutomata::States::OperatorDot:
+    case FiniteAutomata::States::OperatorCompare:
+    case FiniteAutomata::States::OperatorMult:
+    case FiniteAutomata::States::OperatorAssign:
+    case FiniteAutomata::States::Slash:
+    case FiniteAutomata::States::LeftParenthesis:
+        lowered.resize(raw.length());
+        std::transform(raw.begin(), raw.end(), lowered.begin(), ::tolower);
+        if (const Keyword_t* keyword = findKeyword(lowered)) {
+            _value.s = keyword->text;
+            _class = keyword->cls;
+            _subClass = keyword->subClass;
+        }
+        else {
+            _value.symbol = Interner::intern(lowered);
+            _class = Class::Identifier;
+            _subClass = SubClass::Identifier;
+        };
+        break;
+
+    case FiniteAutomata::States::Decimal:
+    case FiniteAutomata::States::Bin:
+    case FiniteAutomata::States::Hex:
+    case FiniteAutomata::States::Oct:
+        _value.s = raw.data();
+        _class = Class::Constant;
+        _subClass = SubClass::IntConst;
+        break;
+
+    case FiniteAutomata::States::Float:
+    case FiniteAutomata::States::FloatEnd:
+    case FiniteAutomata::States::FloatingPoint:
+        _value.s = raw.data();
+        _class = Class::Constant;
+        _subClass = SubClass::FloatConst;
+        break;
+
+    case FiniteAutomata::States::DecimalCharCode:
+    case FiniteAutomata::States::BinCharCode:
+    case FiniteAutomata::States::HexCharCode:
+    case FiniteAutomata::States::OctCharCode:
+    case FiniteAutomata::States::StringEnd:
+    case FiniteAutomata::States::EndOfFile:
+        // the EOF raw text is a static NUL-terminated "EOF"
+        _value.s = state == FiniteAutomata::States::EndOfFile ? raw.data() : value.data();
+        _class = Class::StringLiteral;
+        _subClass = (state == FiniteAutomata::States::EndOfFile ? SubClass::EndOfFile : SubClass::StringLiteral);
+
+    default:
+        break;
+    };
+};
+
+Token::ValueType Token::vtype() const {
+    switch (_subClass) {
+    case SubClass::IntConst:
+        return ValueType::ULL;
+    case SubClass::FloatConst:
+        return ValueType::Double;
+    case SubClass::Identifier:
+        return ValueType::Symbol;
+    default:
+        return ValueType::String;
+    };
+};
+
+// The lexer has already rejected literals that don't fit, see isInRange. Tokens that
+// aren't integer constants (a constant's identifier as a subrange bound) read as 0.
+unsigned long long Token::intValue() const {
+    if (_subClass != SubClass::IntConst)
+        return 0;
+    const char* first = _value.s;
+    unsigned int base = 10;
+    switch (*first) {
+    case '%':
+        base = 2;
+        ++first;
+        break;
+    case '&':
+        base = 8;
+        ++first;
+        break;
+    case '$':
+        base = 16;
+        ++first;
+        break;
+    };
+    unsigned long long value = 0;
+    std::from_chars(first, _value.s + _length, value, base);
+    return value;
+};
+
+// Underflow leaves the result untouched, so it reads as 0
+double Token::floatValue() const {
+    double value = 0;
+    if (_subClass != SubClass::FloatConst)
+        return value;
+    std::from_chars(_value.s, _value.s + _length, value);
+    return value;
+};
+
+// Counting digits is enough to tell whether an integer fits 64 bits, only a literal with
+// exactly as many significant digits as the maximum needs a comparison. Reals only get
+// converted when their decimal exponent is close to the double limit.
+bool Token::isInRange(FiniteAutomata::States state, std::string_view raw) {
+    static const std::string_view maxDecimal = "18446744073709551615";
+    static const std::string_view maxOctal = "1777777777777777777777";
+    std::string_view digits = raw;
+    switch (state) {
+    case FiniteAutomata::States::Decimal:
+    case FiniteAutomata::States::Bin:
+    case FiniteAutomata::States::Hex:
+    case FiniteAutomata::States::Oct: {
+        if (state != FiniteAutomata::States::Decimal)
+            digits.remove_prefix(1);
+        size_t significant = digits.find_first_not_of('0');
+        digits.remove_prefix(significant == std::string_view::npos ? digits.length() : significant);
+        switch (state) {
+        case FiniteAutomata::States::Bin:
+            return digits.length() <= 64;
+        case FiniteAutomata::States::Hex:
+            return digits.length() <= 16;
+        case FiniteAutomata::States::Oct:
+            return digits.length() < maxOctal.length() || (digits.length() == maxOctal.length() && digits <= maxOctal);
+        default:
+            return digits.length() < maxDecimal.length() || (digits.length() == maxDecimal.length() && digits <= maxDecimal);
+        };
+    }
+    case FiniteAutomata::States::Float:
+    case FiniteAutomata::States::FloatEnd:
+    case FiniteAutomata::States::FloatingPoint: {
+        size_t significant = digits.find_first_not_of('0');
+        size_t point = digits.find_first_of(".eE");
+        long long exponent = point == std::string_view::npos || significant >= point ? 0 : static_cast<long long>(point - significant) - 1;
+        size_t e = digits.find_first_of("eE");
+        if (e != std::string_view::npos) {
+            bool negative = e + 1 < digits.length() && digits[e + 1] == '-';
+            long long scale = 0;
+            for (size_t i = e + 1; i < digits.length() && scale < 100000; ++i)
+                if (digits[i] >= '0' && digits[i] <= '9')
+                    scale = scale * 10 + digits[i] - '0';
+            exponent += negative ? -scale : scale;
+        };
+        if (exponent < 307)
+            return true;
+        double value;
+        return std::from_chars(raw.data(), raw.data() + raw.length(), value).ec != std::errc::result_out_of_range;
+    }
+    default:
+        return true;
+    };
+};
+
+std::string Token::toString() const {
+    Chars_t scratch;
+    return std::string(text(scratch));
+};
+
+std::string_view Token::text(Chars_t& scratch) const {
+    switch (vtype()) {
+    case Token::ValueType::ULL:
+        return std::string_view(scratch.data(), std::to_chars(scratch.data(), scratch.data() + scratch.size(), intValue()).ptr - scratch.data());
+    case Token::ValueType::Double:
+        // what std::scientific prints: six digits after the point
+        return std::string_view(scratch.data(), std::to_chars(scratch.data(), scratch.data() + scratch.size(), floatValue(), std::chars_format::scientific, 6).ptr - scratch.data());
+    case Token::ValueType::String:
+        return _value.s;
+    case Token::ValueType::Symbol:
+        return Interner::name(_value.symbol);
+    default:
+        return "";
+    }
 };
\ No newline at end of file
@@ -1,148 +1,196 @@
-#pragma once
-#include "FiniteAutomata.hpp"
-#include <utility>
-#include <string>
-#include <map>
-#include <sstream>
-
-class Token {
-
-    union Value {
-        char* s;
-        double d;
-        unsigned long long ull;
-    };
-
-    enum class ValueType {
-        String,
-        Double,
-        ULL,
-    };
-
-    enum class Class {
-        ReservedWord,
-        Identifier,
-        Operator,
-        Separator,
-        Constant,
-        StringLiteral,
-    };
-
-    enum class SubClass {
-        Add,
-        Sub,
-        Mult,
-        Div,
-        Equal,
-        Less,
-        More,
-        Address,
-        Pointer,
-        Dot,
-        AddAssign,
-        SubAssign,
-        MultAssign,
-        DivAssign,
-        Assign,
-        LEQ,
-        MEQ,
-        NEQ,
-        SymDiff,
-        Exp,
-        Subrange,
-        And,
-        Or,
-        IntDiv,
-        Mod,
-        Not,
-        SHL,
-        SHR,
-        Xor,
-
-        Colon,
-        Comma,
-        Semicolon,
-        LeftBracket,
-        RightBracket,
-        LeftParenthesis,
-        RightParenthesis,
-
-        Absolute,
-        Array,
-        Asm,
-        Begin,
-        Break,
-        Case,
-        Const,
-        Constructor,
-        Continue,
-        Destructor,
-        Do,
-        DownTo,
-        Else,
-        End,
-        False,
-        File,
-        For,
-        Function,
-        Goto,
-        If,
-        Implementation,
-        In,
-        Inline,
-        Interface,
-        Label,
-        Nil,
-        Object,
-        Of,
-        Packed,
-        Procedure,
-        Program,
-        Record,
-        Repeat,
-        Set,
-        String,
-        Then,
-        To,
-        True,
-        Type,
-        Unit,
-        Until,
-        Uses,
-        Var,
-        While,
-        With,
-
-        IntConst,
-        FloatConst,
-        Identifier,
-        StringLiteral,
-        EndOfFile,
-    };
-
-    typedef std::pair<int, int> Position_t;
-    typedef std::map<std::string, std::pair<SubClass, Class>> Dict_t;
-
-    public:
-        Token(FiniteAutomata::States state, Position_t pos, std::string raw, std::string value);
-        Token() {};
-        ~Token() {};
-
-    private:
-        std::string toString();
-
-        Class _class;
-        SubClass _subClass;
-        Value _value;
-        ValueType _vtype;
-        Position_t _pos;
-        std::string _raw;
-        static const Dict_t _dict;
-        friend class LexicalAnalyzer;
-        friend class Node;
-        friend class Subrange;
-        friend class Parser;
-        friend class AsmCode;
-        friend class UnaryOperator;
-        friend class BinaryOperator;
-};
\ No newline at end of file
+#pragma once
+#include "FiniteAutomata.hpp"
+#include "Interner.hpp"
+#include <utility>
+#include <string>
+#include <string_view>
+#include <map>
+#include <array>
+#include <sstream>
+#include <cstdint>
+#include <type_traits>
+#include <charconv>
+
+class Token {
+
+    union Value {
+        const char* s;
+        Interner::Symbol_t symbol;
+    };
+
+    enum class ValueType : unsigned char {
+        String,
+        Double,
+        ULL,
+        Symbol,
+    };
+
+    enum class Class : unsigned char {
+        ReservedWord,
+        Identifier,
+        Operator,
+        Separator,
+        Constant,
+        StringLiteral,
+    };
+
+    enum class SubClass : unsigned char {
+        Add,
+        Sub,
+        Mult,
+        Div,
+        Equal,
+        Less,
+        More,
+        Address,
+        Pointer,
+        Dot,
+        AddAssign,
+        SubAssign,
+        MultAssign,
+        DivAssign,
+        Assign,
+        LEQ,
+        MEQ,
+        NEQ,
+        SymDiff,
+        Exp,
+        Subrange,
+        And,
+        Or,
+        IntDiv,
+        Mod,
+        Not,
+        SHL,
+        SHR,
+        Xor,
+
+        Colon,
+        Comma,
+        Semicolon,
+        LeftBracket,
+        RightBracket,
+        LeftParenthesis,
+        RightParenthesis,
+
+        Absolute,
+        Array,
+        Asm,
+        Begin,
+        Break,
+        Case,
+        Const,
+        Constructor,
+        Continue,
+        Destructor,
+        Do,
+        DownTo,
+        Else,
+        End,
+        False,
+        File,
+        For,
+        Function,
+        Goto,
+        If,
+        Implementation,
+        In,
+        Inline,
+        Interface,
+        Label,
+        Nil,
+        Object,
+        Of,
+        Packed,
+        Procedure,
+        Program,
+        Record,
+        Repeat,
+        Set,
+        String,
+        Then,
+        To,
+        True,
+        Type,
+        Unit,
+        Until,
+        Uses,
+        Var,
+        While,
+        With,
+
+        IntConst,
+        FloatConst,
+        Identifier,
+        StringLiteral,
+        EndOfFile,
+    };
+
+    struct Keyword_t {
+        const char* text;
+        unsigned char length;
+        SubClass subClass;
+        Class cls;
+    };
+
+    typedef std::pair<int, int> Position_t;
+    typedef std::array<unsigned char, 512> KeywordSlots_t;
+    typedef std::array<char, 32> Chars_t;
+
+    public:
+        // value is the decoded string literal, already copied into the lexer's arena
+        Token(FiniteAutomata::States state, uint32_t offset, std::string_view raw, std::string_view value);
+        Token() : _offset(0), _length(0), _class(Class::Constant), _subClass(SubClass::EndOfFile) { _value.s = ""; };
+
+    private:
+        std::string toString() const;
+        // toString() without the allocation, numbers are formatted into scratch
+        std::string_view text(Chars_t& scratch) const;
+        ValueType vtype() const;
+        // Numbers keep pointing at their source text and are converted on every call
+        unsigned long long intValue() const;
+        double floatValue() const;
+        static bool isInRange(FiniteAutomata::States state, std::string_view raw);
+        Interner::Symbol_t symbol() const { return _subClass == SubClass::Identifier ? _value.symbol : Interner::NoSymbol; };
+        static const Keyword_t* findKeyword(std::string_view s);
+
+        // Multiplicative hash over (first char, second char, last char, length), perfect on
+        // _keywords with 9 bits; Token.cpp static_asserts that, pick a new multiplier if it fires
+        static constexpr unsigned int keywordHash(const char* s, size_t length) {
+            return ((static_cast<unsigned char>(s[0]) |
+                     (length > 1 ? static_cast<unsigned char>(s[1]) : 0u) << 8 |
+                     static_cast<unsigned char>(s[length - 1]) << 16 |
+                     static_cast<unsigned int>(length) << 24) * 0xff9c942bu) >> 23;
+        };
+        static constexpr KeywordSlots_t buildKeywordSlots();
+        static constexpr bool keywordSlotsArePerfect();
+
+        // 24 bytes, copied by value all over the parser: the payload is a symbol id or points
+        // at static keyword text, arena memory or the source text of a number, never owned.
+        // The raw text is _length bytes at _offset in the lexer's source buffer, the row and
+        // column are looked up from _offset by the lexer when a message needs them.
+        Value _value;
+        uint32_t _offset;
+        uint32_t _length;
+        Class _class;
+        SubClass _subClass;
+        static const Keyword_t _keywords[];
+        static const KeywordSlots_t _keywordSlots;
+        static const unsigned char NoKeyword = 0xFF;
+        static const size_t MaxKeywordLength = 14;
+        friend class LexicalAnalyzer;
+        friend class Node;
+        friend class Subrange;
+        friend class Parser;
+        friend class AsmCode;
+        friend class UnaryOperator;
+        friend class BinaryOperator;
+        friend class Benchmark;
+        friend class FlatTree;
+        friend class ParallelLexer;
+        friend class IncrementalLexer;
+        friend class TokenStream;
+        friend class LineIndex;
+};
+
+static_assert(std::is_trivially_copyable<Token>::value && sizeof(Token) <= 24, "Token must stay a small trivially copyable value");
@@ -0,0 +1,161 @@
+#include "TokenStream.hpp"
+#include "LexicalAnalyzer.hpp"
+#include <cstring>
+#include <unordered_map>
+
+// A UTF-8 continuation byte first, like PNG's 0x89: no source text starts with it, so no source
+// is ever taken for a token file
+const char TokenStream::Magic[4] = { '\x89', 'P', 'T', 'K' };
+
+void TokenStream::write(const char* filename, std::ostream& os) {
+    LexicalAnalyzer lexer(filename);
+    std::vector<Token> tokens;
+    std::string error;
+    try {
+        while (!lexer.eof())
+            tokens.push_back(lexer.nextToken());
+    } catch (std::exception e) {
+        error = e.what();
+    };
+
+    // names first, they are interned when the file is opened
+    std::vector<std::string_view> names, strings;
+    std::unordered_map<std::string_view, uint32_t> stringIndex;
+    std::vector<uint32_t> symbolIndex(Interner::size(), NoString);
+    auto add = [&](std::string_view s) {
+        auto i = stringIndex.emplace(s, static_cast<uint32_t>(strings.size()));
+        if (i.second)
+            strings.push_back(s);
+        return i.first->second;
+    };
+
+    std::vector<Record_t> records(tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        const Token& t = tokens[i];
+        Record_t& r = records[i];
+        r.offset = t._offset;
+        r.length = t._length;
+        r.cls = static_cast<unsigned char>(t._class);
+        r.subClass = static_cast<unsigned char>(t._subClass);
+        switch (t.vtype()) {
+        case Token::ValueType::Symbol:
+            if (symbolIndex[t._value.symbol] == NoString) {
+                symbolIndex[t._value.symbol] = static_cast<uint32_t>(names.size());
+                names.push_back(Interner::name(t._value.symbol));
+            };
+            r.value = symbolIndex[t._value.symbol];
+            break;
+        case Token::ValueType::String:
+            r.value = add(t._value.s);
+            break;
+        default:
+            // numbers are converted from the stored source text
+            r.value = NoString;
+            break;
+        };
+    };
+    for (auto& r : records)
+        if (r.value != NoString && r.subClass != static_cast<unsigned char>(Token::SubClass::Identifier))
+            r.value += static_cast<uint32_t>(names.size());
+
+    Header_t header = {};
+    memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.tokens = static_cast<uint32_t>(records.size());
+    header.error = error.empty() ? NoString : static_cast<uint32_t>(names.size()) + add(error);
+    header.names = static_cast<uint32_t>(names.size());
+    header.strings = static_cast<uint32_t>(names.size() + strings.size());
+    strings.insert(strings.begin(), names.begin(), names.end());
+    std::vector<uint32_t> offsets(static_cast<size_t>(padded((strings.size() + 1) * sizeof(uint32_t))) / sizeof(uint32_t), 0);
+    for (size_t i = 0; i < strings.size(); ++i)
+        offsets[i + 1] = static_cast<uint32_t>(offsets[i] + strings[i].length() + 1);
+    header.stringBytes = offsets[strings.size()];
+    header.sourceSize = lexer._end - lexer._base;
+
+    static const char zeros[8] = {};
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record_t));
+    os.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+    for (auto s : strings) {
+        os.write(s.data(), s.length());
+        os.write(zeros, 1);
+    };
+    os.write(zeros, padded(header.stringBytes) - header.stringBytes);
+    os.write(lexer._base, header.sourceSize);
+};
+
+bool TokenStream::isTokenFile(const SourceBuffer& file) {
+    return file.size() >= sizeof(Header_t) && !memcmp(file.begin(), Magic, sizeof(Magic));
+};
+
+void TokenStream::corrupt() {
+    throw std::exception("Corrupt or incompatible token file");
+};
+
+TokenStream::TokenStream(const SourceBuffer& file) : _next(0) {
+    const char* at = file.begin();
+    if (file.size() < sizeof(_header))
+        corrupt();
+    memcpy(&_header, at, sizeof(_header));
+    // The counts and sizes are the file's word: taken in 64 bits and each one bounded by the
+    // file before they are added up, none of the sums can wrap
+    uint64_t available = file.size() - sizeof(_header);
+    uint64_t recordBytes = _header.tokens * static_cast<uint64_t>(sizeof(Record_t));
+    uint64_t offsetBytes = padded((_header.strings + static_cast<uint64_t>(1)) * sizeof(uint32_t));
+    if (_header.version != Version || _header.names > _header.strings ||
+        _header.stringBytes > available || _header.sourceSize > available ||
+        recordBytes + offsetBytes + padded(_header.stringBytes) + _header.sourceSize != available)
+        corrupt();
+
+    _records = reinterpret_cast<const Record_t*>(at + sizeof(_header));
+    const uint32_t* offsets = reinterpret_cast<const uint32_t*>(at + sizeof(_header) + recordBytes);
+    const char* strings = at + sizeof(_header) + recordBytes + offsetBytes;
+    _source = strings + padded(_header.stringBytes);
+    if (_header.error != NoString && (_header.error < _header.names || _header.error >= _header.strings))
+        corrupt();
+
+    // every table entry becomes the payload of the tokens that refer to it, numbers take
+    // the extra last one and get pointed at their source text
+    _values.resize(static_cast<size_t>(_header.strings) + 1);
+    for (uint32_t i = 0; i < _header.strings; ++i) {
+        if (offsets[i + 1] <= offsets[i] || offsets[i + 1] > _header.stringBytes || strings[offsets[i + 1] - 1])
+            corrupt();
+        if (i < _header.names)
+            _values[i].symbol = Interner::intern(std::string_view(strings + offsets[i], offsets[i + 1] - offsets[i] - 1));
+        else
+            _values[i].s = strings + offsets[i];
+    };
+    _values.back().s = nullptr;
+};
+
+bool TokenStream::next(Token& t) {
+    if (_next == _header.tokens)
+        return false;
+    const Record_t& r = _records[_next];
+    bool isNumber = r.subClass == static_cast<unsigned char>(Token::SubClass::IntConst) ||
+                    r.subClass == static_cast<unsigned char>(Token::SubClass::FloatConst);
+    bool isName = r.subClass == static_cast<unsigned char>(Token::SubClass::Identifier);
+    // the EOF token's span is "EOF" past the end, raw() never looks at it
+    bool isEof = r.subClass == static_cast<unsigned char>(Token::SubClass::EndOfFile);
+    uint32_t value = isNumber ? _header.strings : r.value;
+    if (r.cls > static_cast<unsigned char>(Token::Class::StringLiteral) ||
+        r.subClass > static_cast<unsigned char>(Token::SubClass::EndOfFile) || isNumber != (r.value == NoString) ||
+        (!isNumber && (value >= _header.strings || isName != (value < _header.names))) ||
+        (!isEof && r.offset + static_cast<uint64_t>(r.length) > _header.sourceSize))
+        corrupt();
+    t._offset = r.offset;
+    t._length = r.length;
+    t._class = static_cast<Token::Class>(r.cls);
+    t._subClass = static_cast<Token::SubClass>(r.subClass);
+    t._value = _values[value];
+    if (isNumber)
+        t._value.s = _source + r.offset;
+    ++_next;
+    return true;
+};
+
+std::exception_ptr TokenStream::error() const {
+    if (_header.error == NoString)
+        return nullptr;
+    return std::make_exception_ptr(std::exception(_values[_header.error].s));
+};
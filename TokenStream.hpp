@@ -0,0 +1,69 @@
+#pragma once
+#include "Token.hpp"
+#include "SourceBuffer.hpp"
+#include <cstdint>
+#include <exception>
+#include <ostream>
+#include <vector>
+
+// Binary token file, written once and then read by LexicalAnalyzer::open instead of lexing.
+// Little-endian, laid out to be decoded straight from the memory-mapped file:
+//     Header_t
+//     Record_t[tokens]             raw span, class and value of each token
+//     uint32_t[strings + 1]        offsets of the string table entries, padded to 8
+//     string table                 '\0'-terminated: names first, then keywords, literals
+//                                  and the error message
+//     source text                  raw spans and numbers point here, rows and columns are
+//                                  counted from it by the reading lexer like from a source
+// Tokens are decoded on demand into the lexer's ring. The names are interned again when
+// the file is opened, once per distinct name rather than per token.
+class TokenStream {
+
+    struct Header_t {
+        char magic[4];
+        uint32_t version;
+        uint32_t tokens;
+        uint32_t names;
+        uint32_t strings;
+        uint32_t error;
+        uint64_t stringBytes;
+        uint64_t sourceSize;
+    };
+
+    struct Record_t {
+        uint32_t offset;
+        uint32_t length;
+        uint32_t value;
+        unsigned char cls;
+        unsigned char subClass;
+        uint16_t reserved;
+    };
+
+    public:
+        // Checks the header and the tables of a buffer holding a token file
+        TokenStream(const SourceBuffer& file);
+
+        // Lexes filename and writes its tokens, up to the first error if there is one
+        static void write(const char* filename, std::ostream& os);
+        static bool isTokenFile(const SourceBuffer& file);
+
+        // Decodes the next token into t, false past the last one
+        bool next(Token& t);
+        // The lexical error the stream ended with, if any
+        std::exception_ptr error() const;
+        const char* source() const { return _source; };
+        size_t sourceSize() const { return _header.sourceSize; };
+
+    private:
+        static uint64_t padded(uint64_t size) { return (size + 7) & ~static_cast<uint64_t>(7); };
+        static void corrupt();
+
+        Header_t _header;
+        const Record_t* _records;
+        const char* _source;
+        size_t _next;
+        std::vector<Token::Value> _values;
+        static const char Magic[4];
+        static const uint32_t Version = 2;
+        static const uint32_t NoString = static_cast<uint32_t>(-1);
+};
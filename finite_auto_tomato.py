@@ -1,116 +0,0 @@
-from tabulate import tabulate
-states = {}
-states['T'] = 'TokenEnd,'
-states['w'] = 'Whitespace,'
-states['b'] = 'Bin,'
-states['n'] = 'NewLine,'
-states['i'] = 'Identifier,'
-states['^'] = 'LookBack,' 
-states['%'] = 'Percent,' 
-states['$'] = 'Dollar,' 
-states['o'] = 'Oct,'
-states['&'] = 'Ampersand,'
-states['d'] = 'Decimal,'
-states[','] = 'FloatingPoint,'
-states['f'] = 'Float,'
-states['e'] = 'FloatExp,'
-states['-'] = 'FloatExpSign,'
-states['z'] = 'FloatEnd,'
-states['h'] = 'Hex,'
-states['s'] = 'String,'
-states['q'] = 'StringStart,'
-states['l'] = 'StringEnd,'
-states['#'] = 'ControlString,' 
-states['D'] = 'DecimalCharCode,'
-states['B'] = 'BinCharCode,'
-states['H'] = 'HexCharCode,'
-states['O'] = 'OctCharCode,'
-states['='] = 'Operator,'
-states['.'] = 'OperatorDot,'
-states['<'] = 'OperatorLess,'
-states['>'] = 'OperatorGreater,'
-states['*'] = 'OperatorMult,'
-states['+'] = 'OperatorPlus,'
-states['/'] = 'Slash,'
-states[':'] = 'Colon,'
-states[';'] = 'Separator,'
-states['('] = "LeftParenthesis,"
-states['_'] = 'BeginComment,'
-states['c'] = 'Comment,'
-states['~'] = "BeginMultilineComment,"
-states['m'] = 'MultilineComment,'
-states['M'] = 'CommentNewLine,'
-states['a'] = 'Asterisk,'
-states['"'] = 'Amount,'
-states['E'] = 'EndOfFile,' 
-states['?'] = 'IllegalSymbol,'
-states['U'] = 'UnexpectedSymbol,'
-states['L'] = 'EOLnWhileReading,' 
-states['!'] = 'UnexpectedEndOfFile,' 
-states['F'] = 'ScaleFactorExpected,'
-states['N'] = 'NumberExpected,'
-
-data = []   #'  \t\n \r !"#$%& \'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~ EOF'
-data.append(r' ????????  w n??  n??????????????????w??#$%&  q(;*+;+./dddddddddd:;<=>?=??????????????????????????; ?;=i?iiiiiiiiiiiiiiiiiiiiiiiiii~?U?? E  ') # TokenEnd
-data.append(r' ????????  w n??  n??????????????????w??#$%&  q(;*+;+./dddddddddd:;<=>?=??????????????????????????; ?;=i?iiiiiiiiiiiiiiiiiiiiiiiiii~?U?? E  ') # Whitespace
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTbbTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Bin
-data.append(r' ????????  w n??  n??????????????????w??#$%&  q(;*+;+./dddddddddd:;<=>?=??????????????????????????; ?;=i?iiiiiiiiiiiiiiiiiiiiiiiiii~?U?? E  ') # NewLine
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTiiiiiiiiiiTTTTT?T??????????????????????????T ?TTi?iiiiiiiiiiiiiiiiiiiiiiiiiiT?U?? T  ') # Identifier
-data.append(r' ????????  ? ???  ??????????????????????????  ??;????.????????????????????????????????????????????? ???????????????????????????????????? ?  ') # LookBack
-data.append(r' ????????  N N??  N??????????????????N??UUUU  UUUUUUUUUbbUUUUUUUUUUUUU?U??????????????????????????U ?UUU?UUUUUUUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # Percent
-data.append(r' ????????  N N??  N??????????????????N??UUUU  UUUUUUUUUhhhhhhhhhhUUUUU?U??????????????????????????U ?UUU?hhhhhhUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # Dollar
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTooooooooTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Oct
-data.append(r' ????????  N N??  N??????????????????N??UUUU  UUUUUUUUUooooooooUUUUUUU?U??????????????????????????U ?UUi?iiiiiiiiiiiiiiiiiiiiiiiiiiU?U?? !  ') # Ampersand
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTT,TddddddddddTTTTT?T??????????????????????????T ?TTT?TTTTeTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Decimal
-data.append(r' ????????  T T??  T??????????????????T??UUUU  UU^UUUU^UffffffffffUUUUU?U??????????????????????????U ?UUU?UUUUUUUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # FloatingPoint
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTffffffffffTTTTT?T??????????????????????????T ?TTT?TTTTeTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Float
-data.append(r' ????????  F F??  F??????????????????F??UUUU  UUUU-U-UUzzzzzzzzzzUUUUU?U??????????????????????????U ?UUU?UUUUUUUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # FloatExp
-data.append(r' ????????  F F??  F??????????????????F??UUUU  UUUUUUUUUzzzzzzzzzzUUUUU?U??????????????????????????U ?UUU?UUUUUUUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # FloatExpSign
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTzzzzzzzzzzTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # FloatEnd
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTThhhhhhhhhhTTTTT?T??????????????????????????T ?TTT?hhhhhhTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Hex
-data.append(r' ????????  s L??  L??????????????????sssssss  lssssssssssssssssssssssssssssssssssssssssssssssssssss sssssssssssssssssssssssssssssssssss? !  ') # String
-data.append(r' ????????  s L??  L??????????????????sssssss  lssssssssssssssssssssssssssssssssssssssssssssssssssss sssssssssssssssssssssssssssssssssss? !  ') # StringStart
-data.append(r' ????????  T T??  T??????????????????T??#TTT  sTTTTTTTTTTTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # StringEnd
-data.append(r' ????????  N N??  N??????????????????N??UHBO  UUUUUUUUUDDDDDDDDDDUUUUU?U??????????????????????????U ?UUU?UUUUUUUUUUUUUUUUUUUUUUUUUUU?U?? !  ') # ControlString
-            #'  \t\n \r !"#$%& \'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRST?VWXYZ[\\]^_`abcdefghijklmnopqrst?vwxyz{|}~ EOF'
-data.append(r' ????????  T T??  T??????????????????T??#TTT  qTTTTTTTTDDDDDDDDDDTTTTT?T??????????????????????????T ?TTT?UUUUUUUUUUUUUUUUUUUUUUUUUUT?U?? T  ') # DecimalCharCode
-data.append(r' ????????  T T??  T??????????????????T??#TTT  qTTTTTTTTBBUUUUUUUUTTTTT?T??????????????????????????T ?TTT?UUUUUUUUUUUUUUUUUUUUUUUUUUT?U?? T  ') # BinCharCode
-data.append(r' ????????  T T??  T??????????????????T??#TTT  qTTTTTTTTHHHHHHHHHHTTTTT?T??????????????????????????T ?TTT?HHHHHHUUUUUUUUUUUUUUUUUUUUT?U?? T  ') # HexCharCode
-data.append(r' ????????  T T??  T??????????????????T??#TTT  qTTTTTTTTOOOOOOOOOOTTTTT?T??????????????????????????T ?TTT?UUUUUUUUUUUUUUUUUUUUUUUUUUT?U?? T  ') # OctCharCode
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Operator
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TT;TTTT=TTTTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # OperatorDot
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTT===?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # OperatorLess
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTT===?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # OperatorFreater
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTT=TTTTTTTTTTTTTTTTTT=T?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # OperatorMult
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTTT=T?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # OperatorPlus
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTT_TTTTTTTTTTTTT=T?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Slash
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTTT=T?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Colon
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTTTTTTTTTTTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # Separator
-data.append(r' ????????  T T??  T??????????????????T??TTTT  TTT~TTT;TTTTTTTTTTTTTTTT?T??????????????????????????T ?TTT?TTTTTTTTTTTTTTTTTTTTTTTTTTT?U?? T  ') # LeftParenthesis
-data.append(r' ????????  c n??  n??????????????????c??cccc  ccccccccccccccccccccccccccccccccccccccccccccccccccccc ccccccccccccccccccccccccccccccccccc? E  ') # BeginComment
-data.append(r' ????????  c n??  n??????????????????c??cccc  ccccccccccccccccccccccccccccccccccccccccccccccccccccc ccccccccccccccccccccccccccccccccccc? E  ') # Comment
-data.append(r' ????????  m M??  M??????????????????m??mmmm  mmmammmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm mmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmwm? !  ') # BeginMultilineComment
-data.append(r' ????????  m M??  M??????????????????m??mmmm  mmmammmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm mmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmwm? !  ') # MultilineComment
-data.append(r' ????????  m M??  M??????????????????m??mmmm  mmmammmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm mmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmwm? !  ') # CommentNewLine
-data.append(r' ????????  m M??  M??????????????????m??mmmm  mmwmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm mmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmwm? !  ') # Asterisk
-
-with open('FiniteAutomata.hpp', 'w') as f:
-	print('#pragma once', file=f)
-	print('namespace FiniteAutomata {', file=f)
-	print('\tenum class States {', file=f)
-	for x in states:
-		print('\t\t' + states[x], file=f)
-	print('\t};\n', file=f)
-	print('\tstatic const States states[static_cast<unsigned int>(States::Amount)][128] = {', file=f)
-
-	rdata = []
-	for i in data:
-	    rdata.append(['********{'])
-	    for j in i:
-	        if j == ' ':
-	            continue
-	        rdata[-1].append('States::' + states[j])
-	    rdata[-1].append('},')
-
-	print(tabulate(rdata, tablefmt='plain', numalign='None').replace('*', ' '), file=f)
-	print('\t};\n}', file=f)
\ No newline at end of file
@@ -1,30 +1,109 @@
-#include "LexicalAnalyzer.hpp"
-#include "Parser.hpp"
-#include <locale>
-#include <codecvt>
-
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cout << "\nPascal Compiler\nAlexander Gomeniuk, Far Eastern FU -- B8303a, 2017\n\n";
-        std::cout << "usage: PascalCompiler [-l] File\n";
-        std::cout << "-l\tlexical analysis\n";
-    };
-
-    for (int i = 0; i < argc; ++i) {
-        if (std::string(argv[i]) == "-l")
-            LexicalAnalyzer(argv[i + 1]).log(std::ofstream("tokens.log"));
-        else if (std::string(argv[i]) == "-ast") {
-            const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
-            std::wofstream stream("syntax.log");
-            stream.imbue(utf8_locale);
-            Parser(argv[i + 1]).log(stream);
-        };
-    };
-
-    const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
-    std::wofstream stream("syntax.log");
-    stream.imbue(utf8_locale);
-
-    Parser p("input.txt");
-    p.log(stream);
+#include "LexicalAnalyzer.hpp"
+#include "Parser.hpp"
+#include "Benchmark.hpp"
+#include "TokenStream.hpp"
+#include "ProgramGenerator.hpp"
+#include <locale>
+#include <codecvt>
+#include <algorithm>
+#include <cstdlib>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "\nPascal Compiler\nAlexander Gomeniuk, Far Eastern FU -- B8303a, 2017\n\n";
+        std::cout << "usage: PascalCompiler [-l] File\n";
+        std::cout << "-l\tlexical analysis\n";
+        std::cout << "-bk\tkeyword lookup benchmark over a file or directory\n";
+        std::cout << "-bl\tlexer throughput benchmark over a file or directory\n";
+        std::cout << "-bi\tincremental lexing benchmark, checked against lexing from scratch, over a file or directory\n";
+        std::cout << "-bs\tlexer and parser benchmark suite over a file or directory and synthetic programs, as JSON\n";
+        std::cout << "-j N\tlex large files and parse routine bodies with N threads\n";
+        std::cout << "-e E\tDFA engine, table or direct (direct-coded)\n";
+        std::cout << "-g F\twrite a generated program to F, \"-\" is stdout\n";
+        std::cout << "-gs N\tgenerated program size in bytes\n";
+        std::cout << "-gd N\tnesting depth of generated statements, records and expressions\n";
+        std::cout << "-gi N\tgenerated variables per scope\n";
+        std::cout << "-gr N\tgenerator seed\n";
+        std::cout << "-gm M\tgenerator mix: balanced, lexer, symbols, expressions or codegen\n";
+        std::cout << "-flat\tsyntax tree to syntax.log like -ast, printed from its flat form\n";
+        std::cout << "-outline\tdeclarations and routine signatures to syntax.log, routine bodies are skimmed\n";
+        std::cout << "-tw\twrite the token stream to tokens.tok\n";
+        std::cout << "-tr\tlog a token file written by -tw like -l does, -ast reads token files too\n";
+        std::cout << "File\tsource file, \"-\" reads stdin\n";
+    };
+
+    ProgramGenerator::Options_t options = ProgramGenerator::Defaults;
+    for (int i = 1; i + 1 < argc; ++i)
+        if (std::string(argv[i]) == "-j") {
+            LexicalAnalyzer::setThreads(std::max(1, std::atoi(argv[i + 1])));
+            Parser::setThreads(std::max(1, std::atoi(argv[i + 1])));
+        }
+        else if (std::string(argv[i]) == "-e")
+            LexicalAnalyzer::setEngine(std::string(argv[i + 1]) == "direct" ? LexicalAnalyzer::Engine::Direct : LexicalAnalyzer::Engine::Table);
+        else if (std::string(argv[i]) == "-gs")
+            options.size = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (std::string(argv[i]) == "-gd")
+            options.depth = std::atoi(argv[i + 1]);
+        else if (std::string(argv[i]) == "-gi")
+            options.identifiers = std::atoi(argv[i + 1]);
+        else if (std::string(argv[i]) == "-gr")
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (std::string(argv[i]) == "-gm") {
+            if (!ProgramGenerator::findMix(argv[i + 1], options.mix))
+                std::cout << "Unknown generator mix \"" << argv[i + 1] << "\"\n";
+        };
+
+    for (int i = 0; i < argc; ++i) {
+        if (std::string(argv[i]) == "-l")
+            LexicalAnalyzer(argv[i + 1]).log(std::ofstream("tokens.log"));
+        else if (std::string(argv[i]) == "-g") {
+            if (std::string(argv[i + 1]) == "-")
+                ProgramGenerator(options).generate(std::cout);
+            else {
+                std::ofstream file(argv[i + 1], std::ios::binary);
+                ProgramGenerator(options).generate(file);
+            };
+        }
+        else if (std::string(argv[i]) == "-tw")
+            TokenStream::write(argv[i + 1], std::ofstream("tokens.tok", std::ios::binary));
+        else if (std::string(argv[i]) == "-tr") {
+            if (!TokenStream::isTokenFile(SourceBuffer(argv[i + 1])))
+                std::cout << "\"" << argv[i + 1] << "\" is not a token file\n";
+            else
+                LexicalAnalyzer(argv[i + 1]).log(std::ofstream("tokens.log"));
+        }
+        else if (std::string(argv[i]) == "-bk")
+            Benchmark::keywords(argv[i + 1], std::cout);
+        else if (std::string(argv[i]) == "-bl")
+            Benchmark::lexer(argv[i + 1], std::cout);
+        else if (std::string(argv[i]) == "-bi")
+            Benchmark::incremental(argv[i + 1], std::cout);
+        else if (std::string(argv[i]) == "-bs")
+            Benchmark::suite(argv[i + 1], std::cout);
+        else if (std::string(argv[i]) == "-ast") {
+            const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
+            std::wofstream stream("syntax.log");
+            stream.imbue(utf8_locale);
+            Parser(argv[i + 1]).log(stream);
+        }
+        else if (std::string(argv[i]) == "-flat") {
+            const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
+            std::wofstream stream("syntax.log");
+            stream.imbue(utf8_locale);
+            Parser(argv[i + 1]).log(stream, true);
+        }
+        else if (std::string(argv[i]) == "-outline") {
+            const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
+            std::wofstream stream("syntax.log");
+            stream.imbue(utf8_locale);
+            Parser(argv[i + 1]).outline(stream);
+        };
+    };
+
+    const std::locale utf8_locale = std::locale(std::locale(), new std::codecvt_utf8<wchar_t>());
+    std::wofstream stream("syntax.log");
+    stream.imbue(utf8_locale);
+
+    Parser p("input.txt");
+    p.log(stream);
 }
\ No newline at end of file
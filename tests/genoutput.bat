@@ -1,5 +1,5 @@
 @echo off
-for /l %%i in (1, 1, 40) do (
+for /l %%i in (1, 1, 74) do (
 	if not exist %%i (
 		md %%i
 		echo.>%%i\%%i.txt
@@ -15,4 +15,20 @@ for /l %%i in (1, 1, 40) do (
 	)
 	popd
 )
+rem PascalCompiler.exe parses input.txt into syntax.log on every run, with -j N it
+rem skims the routine bodies and parses them on N threads
+for /l %%i in (1, 1, 5) do (
+	copy "%~dp0..\..\Debug\PascalCompiler.exe" "%~dp0\ast\%%i" >nul
+	pushd ast\%%i
+	for %%j in (1 4) do (
+		PascalCompiler.exe -j %%j
+		fc /b syntax.log res.txt >nul
+		if not errorlevel 1 (
+			echo Test ast %%i -j %%j: Passed
+		) else (
+			echo Test ast %%i -j %%j: Failed
+		)
+	)
+	popd
+)
 pause
\ No newline at end of file